@@ -9,7 +9,7 @@ private:
   double k_rot_{0.0};
 
   double torque_{0.0};
-  Vec<double> f_vec_;
+  Vec2 f_vec_{};
 
   Object *rot_point_{nullptr}; // Where torque & force acts
   Object *end_point_{nullptr}; // Other end of rod acting as angular spring
@@ -42,13 +42,10 @@ public:
     theta_rest_ = theta_0 * (M_PI / 180.0); // convert to rad
     k_rot_ = k_rot;
     SetCutoffs();
-    for (int i_dim{0}; i_dim < _n_dims_max; i_dim++) {
-      f_vec_.push_back(0.0);
-    }
   }
   bool UpdatePosition() {
     double r_sq{0.0};
-    Vec<double> r_hat(_n_dims_max, 0.0);
+    Vec2 r_hat{};
     for (int i_dim{0}; i_dim < _n_dims_max; i_dim++) {
       r_hat[i_dim] = rot_point_->pos_[i_dim] - end_point_->pos_[i_dim];
       r_sq += Square(r_hat[i_dim]);
@@ -57,8 +54,8 @@ public:
     for (int i_dim{0}; i_dim < _n_dims_max; i_dim++) {
       r_hat[i_dim] /= r_mag;
     }
-    Vec<double> u1{rot_point_->GetBoundObjectOrientation()};
-    Vec<double> u2{end_point_->GetBoundObjectOrientation()};
+    Vec2 u1{rot_point_->GetBoundObjectOrientation()};
+    Vec2 u2{end_point_->GetBoundObjectOrientation()};
     double theta1{M_PI - acos(Dot(r_hat, u1))};
     // if (theta1 > M_PI / 2) {
     //   theta1 = M_PI - theta1;
@@ -85,8 +82,8 @@ public:
     double dtheta2{theta2 - theta_rest_};
     double tq1{dtheta1 != 0.0 ? -k_rot_ * (dtheta1 / sin(dtheta1)) : 0.0};
     double tq2{dtheta2 != 0.0 ? -k_rot_ * (dtheta2 / sin(dtheta2)) : 0.0};
-    Vec<double> f1_hat{Cross(r_hat, Cross(r_hat, u1))};
-    Vec<double> f2_hat{Cross(r_hat, Cross(r_hat, u2))};
+    Vec2 f1_hat{Cross(r_hat, Cross(r_hat, u1))};
+    Vec2 f2_hat{Cross(r_hat, Cross(r_hat, u2))};
     // Torque only comes from dtheta of anchor point
     torque_ = -tq1 * Cross(r_hat, u1);
     if (r_hat[0] > 0.0) {
@@ -13,12 +13,12 @@ int BindingHead::GetNumNeighborsOccupied() {
 
 int BindingHead::GetNumHeadsActive() { return parent_->n_heads_active_; }
 
-Vec<double> BindingHead::GetBoundObjectOrientation() {
+Vec2 BindingHead::GetBoundObjectOrientation() {
   // return site_->filament_->orientation_;
   return site_->filament_->GetPolarOrientation();
 }
 
-void BindingHead::AddForce(Vec<double> f) { site_->AddForce(f); }
+void BindingHead::AddForce(Vec2 const &f) { site_->AddForce(f); }
 void BindingHead::AddTorque(double tq) { site_->AddTorque(tq); }
 
 void BindingHead::UntetherSatellite() { parent_->UntetherSatellite(); }
@@ -34,9 +34,9 @@ public:
   BindingHead *GetOtherHead() { return other_head_; }
   BindingSite *GetSite() { return site_; }
 
-  virtual Vec<double> GetSpringOrientation() {
+  virtual Vec2 GetSpringOrientation() {
     double r_sq{0.0};
-    Vec<double> r_hat(_n_dims_max, 0.0);
+    Vec2 r_hat{};
     for (int i_dim{0}; i_dim < _n_dims_max; i_dim++) {
       r_hat[i_dim] = pos_[i_dim] - GetOtherHead()->pos_[i_dim];
       r_sq += Square(r_hat[i_dim]);
@@ -46,9 +46,9 @@ public:
     }
     return r_hat;
   }
-  virtual Vec<double> GetBoundObjectOrientation();
+  virtual Vec2 GetBoundObjectOrientation();
 
-  virtual void AddForce(Vec<double> f_applied);
+  virtual void AddForce(Vec2 const &f_applied);
   virtual void AddTorque(double tq);
 
   virtual void UntetherSatellite();
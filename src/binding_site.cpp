@@ -1,6 +1,27 @@
 #include "binding_site.hpp"
+#include "binding_head.hpp"
 #include "protofilament.hpp"
 
+void BindingSite::SetOccupant(BindingHead *head) {
+
+  occupant_ = head;
+  for (auto const &neighb : neighbors_) {
+    store_->n_neighbors_occupied_[neighb->index_]++;
+  }
+  filament_->SetOccupied(index_, head->GetSpeciesID() == _id_motor);
+  filament_->FlagForUpdate(this);
+}
+
+void BindingSite::RemoveOccupant() {
+
+  occupant_ = nullptr;
+  for (auto const &neighb : neighbors_) {
+    store_->n_neighbors_occupied_[neighb->index_]--;
+  }
+  filament_->SetUnoccupied(index_);
+  filament_->FlagForUpdate(this);
+}
+
 BindingSite *BindingSite::GetNeighbor(int dir) {
 
   if (dir != 1 and dir != -1) {
@@ -17,5 +38,9 @@ BindingSite *BindingSite::GetNeighbor(int dir) {
   return nullptr;
 }
 
-void BindingSite::AddForce(Vec<double> f) { filament_->AddForce(this, f); }
+Vec2 BindingSite::GetPosition() { return filament_->GetSitePosition(index_); }
+
+void BindingSite::AddForce(Vec2 const &f) {
+  filament_->AddForce(this, f);
+}
 void BindingSite::AddTorque(double tq) { filament_->AddTorque(tq); }
\ No newline at end of file
@@ -6,15 +6,47 @@
 class BindingHead;
 class Protofilament;
 
-class BindingSite : public Sphere {
+// Per-protofilament storage of the site state that is read or written in
+// bulk passes (weight resets, lattice deformation); indexed by site index
+struct SiteStore {
+  Vec<double> weight_bind_;
+  Vec<double> weight_unbind_;
+  Vec<double> binding_affinity_;
+  Vec<double> energy_lattice_; // Sum of motor deformation energies; kbT
+  Vec<int> n_deformations_;    // # of motors deforming each site
+  Vec<int> n_neighbors_occupied_;
+
+  void Resize(size_t n_sites) {
+    weight_bind_.assign(n_sites, 0.0);
+    weight_unbind_.assign(n_sites, 0.0);
+    binding_affinity_.assign(n_sites, 1.0);
+    energy_lattice_.assign(n_sites, 0.0);
+    n_deformations_.assign(n_sites, 0);
+    n_neighbors_occupied_.assign(n_sites, 0);
+  }
+  // Adds (sign = 1) or removes (sign = -1) a single motor's deformation
+  void AddDeformation(size_t i_site, double energy, int sign) {
+    n_deformations_[i_site] += sign;
+    energy_lattice_[i_site] += sign * energy;
+    // Avoid accumulating round-off once no motors remain
+    if (n_deformations_[i_site] == 0) {
+      energy_lattice_[i_site] = 0.0;
+    }
+  }
+  void ClearDeformation() {
+    std::fill(energy_lattice_.begin(), energy_lattice_.end(), 0.0);
+    std::fill(n_deformations_.begin(), n_deformations_.end(), 0);
+  }
+};
+
+class BindingSite final : public Sphere {
 protected:
-  double binding_affinity_{1.0};
   Vec<BindingSite *> neighbors_;
-  double weight_bind_{0.0};
-  double weight_unbind_{0.0};
+  SiteStore *store_{nullptr}; // Owned by filament_
 
 public:
   size_t index_{0};
+  bool modified_{false}; // Whether occupancy changed since last KMC step
   BindingHead *occupant_{nullptr};
   Protofilament *filament_{nullptr};
 
@@ -22,15 +54,22 @@ private:
 public:
   BindingSite() {}
   void Initialize(size_t sid, size_t id, double radius, size_t index,
-                  Protofilament *filament) {
+                  Protofilament *filament, SiteStore *store) {
     Sphere::Initialize(sid, id, radius);
     index_ = index;
     filament_ = filament;
+    store_ = store;
   }
 
-  void SetBindingAffinity(double val) { binding_affinity_ = val; }
+  void SetBindingAffinity(double val) {
+    store_->binding_affinity_[index_] = val;
+  }
 
   void AddNeighbor(BindingSite *site) { neighbors_.emplace_back(site); }
+  Vec<BindingSite *> &GetNeighbors() { return neighbors_; }
+
+  void SetOccupant(BindingHead *head);
+  void RemoveOccupant();
 
   bool IsOccupied() {
     if (occupant_ == nullptr) {
@@ -39,59 +78,38 @@ public:
     return true;
   }
 
-  void SetWeight_Bind(double val) { weight_bind_ = val; }
-  void SetWeight_Unbind(double val) { weight_unbind_ = val; }
-  void AddWeight_Bind(double val) {
-    int n_neighbs{GetNumNeighborsOccupied()};
-    // printf("**heyyyy\n");
-    if (weight_bind_ == Sys::weight_lattice_bind_max_[n_neighbs]) {
-      return;
-    }
-    // printf("**HEY - val = %g\n", val);
-    weight_bind_ *= val;
-    // printf("**AH\n");
-    if (weight_bind_ > Sys::weight_lattice_bind_max_[n_neighbs]) {
-      weight_bind_ = Sys::weight_lattice_bind_max_[n_neighbs];
-      // printf("**u wot\n");
-      return;
+  void SetWeight_Bind(double val) { store_->weight_bind_[index_] = val; }
+  void SetWeight_Unbind(double val) { store_->weight_unbind_[index_] = val; }
+  // Ceilings are applied here rather than as each deformation is added so
+  // that deformations can later be removed in any order
+  double GetWeight_Bind() {
+    double weight{store_->weight_bind_[index_]};
+    if (store_->n_deformations_[index_] > 0) {
+      int n_neighbs{GetNumNeighborsOccupied()};
+      double energy{store_->energy_lattice_[index_]};
+      weight *= exp(-(1.0 - _lambda_lattice) * energy);
+      weight = std::min(weight, Sys::weight_lattice_bind_max_[n_neighbs]);
     }
+    return weight / store_->binding_affinity_[index_];
   }
-  void AddWeight_Unbind(double val) {
-    int n_neighbs{GetNumNeighborsOccupied()};
-    // printf("heyyyy\n");
-    if (weight_unbind_ == Sys::weight_lattice_unbind_max_[n_neighbs]) {
-      return;
-    }
-    // printf("HEY - val = %g\n", val);
-    weight_unbind_ *= val;
-    // printf("AH\n");
-    if (weight_unbind_ > Sys::weight_lattice_unbind_max_[n_neighbs]) {
-      weight_unbind_ = Sys::weight_lattice_unbind_max_[n_neighbs];
-      // printf("u wot\n");
-      return;
+  double GetWeight_Unbind() {
+    double weight{store_->weight_unbind_[index_]};
+    // Unbinding weight of any deformed site is held at its ceiling
+    if (store_->n_deformations_[index_] > 0) {
+      int n_neighbs{GetNumNeighborsOccupied()};
+      weight = std::min(weight, Sys::weight_lattice_unbind_max_[n_neighbs]);
     }
+    return weight * store_->binding_affinity_[index_];
   }
-  double GetWeight_Bind() { return weight_bind_ / binding_affinity_; }
-  double GetWeight_Unbind() { return weight_unbind_ * binding_affinity_; }
 
   int GetNumNeighborsOccupied() {
-    if (_n_neighbs_max == 0) {
-      return 0;
-    }
-    int n_neighbs{0};
-    for (auto const &site : neighbors_) {
-      // printf("hi\n");
-      if (site->occupant_ != nullptr) {
-        n_neighbs++;
-      }
-    }
-    // printf("noh - %i\n", n_neighbs);
-    return n_neighbs;
+    return store_->n_neighbors_occupied_[index_];
   }
 
-  void AddForce(Vec<double> f_applied);
+  void AddForce(Vec2 const &f_applied);
   void AddTorque(double tq);
 
   BindingSite *GetNeighbor(int dir);
+  Vec2 GetPosition(); // Computed from filament_; pos_ is not maintained
 };
 #endif
\ No newline at end of file
@@ -5,7 +5,7 @@
 class BindingSite;
 class Motor;
 
-class CatalyticHead : public BindingHead {
+class CatalyticHead final : public BindingHead {
 private:
 public:
   enum Ligand { NONE, ATP, ADPP, ADP };
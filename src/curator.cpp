@@ -11,7 +11,7 @@ void Curator::CheckArgs(int argc, char *argv[]) {
     printf("test_mode (optional)\n");
     printf("Currently-implemented test modes are:\n");
     for (auto const &mode : test_modes_) {
-      printf("   %s\n", mode.c_str());
+      printf("   %s\n", mode.first.c_str());
     }
     exit(1);
   }
@@ -21,7 +21,7 @@ void Curator::CheckArgs(int argc, char *argv[]) {
     Sys::test_mode_ = argv[3];
     bool valid_mode{false};
     for (auto const &mode : test_modes_) {
-      if (Sys::test_mode_ == mode) {
+      if (Sys::test_mode_ == mode.first) {
         if (argc == 5) {
           if (Sys::test_mode_ == "filament_separation") {
             Sys::n_xlinks_ = std::stoi(argv[4]);
@@ -37,13 +37,14 @@ void Curator::CheckArgs(int argc, char *argv[]) {
           }
         }
         valid_mode = true;
+        Sys::test_ = mode.second;
       }
     }
     if (!valid_mode) {
       printf("\nError! Invalid test mode.\n");
       printf("Currently-implemented test modes are:\n");
       for (auto const &mode : test_modes_) {
-        printf("   %s\n", mode.c_str());
+        printf("   %s\n", mode.first.c_str());
       }
       exit(1);
     }
@@ -125,7 +126,11 @@ void Curator::ParseParameters() {
     try {
       *param = val.as<DATA_T>();
     } catch (const YAML::BadConversion err) {
-      *param = (DATA_T)val.as<double>();
+      if constexpr (std::is_same<DATA_T, Str>::value) {
+        throw;
+      } else {
+        *param = (DATA_T)val.as<double>();
+      }
     }
     // Convert parameter value into a string that we can easily log
     // (Since we don't know data types a priori, we can't use Log() aka printf)
@@ -154,6 +159,15 @@ void Curator::ParseParameters() {
   ParseYAML(&t_snapshot, "t_snapshot", "s");
   ParseYAML(&dynamic_equil_window, "dynamic_equil_window", "s");
   ParseYAML(&verbosity, "verbosity", "");
+  ParseYAML(&kmc_engine, "kmc_engine", "");
+  if (kmc_engine != "leaping" and kmc_engine != "continuous") {
+    Log("Error! KMC engine must be either 'leaping' or 'continuous'.\n");
+    exit(1);
+  }
+  ParseYAML(&dt_max, "dt_max", "s");
+  ParseYAML(&p_step_max, "p_step_max", "");
+  ParseYAML(&conflict_frac_max, "conflict_frac_max", "");
+  ParseYAML(&n_steps_per_sample_max, "n_steps_per_sample_max", "steps");
   Log(" Filament parameters:\n");
   ParseYAML(&Filaments::count, "filaments.count", "filaments");
   ParseYAML(&Filaments::radius, "filaments.radius", "nm");
@@ -245,6 +259,16 @@ void Curator::InitializeSimulation() {
     equilibrating_ = false;
   }
   n_steps_run_ = (size_t)std::round(t_run / dt);
+  if (dt_max > dt) {
+    if (!test_mode_.empty() or kmc_engine != "leaping") {
+      Log("  Adaptive timestep is only used by the leaping engine outside of "
+          "test modes; dt_max will be ignored.\n");
+    } else {
+      while (2 * n_steps_per_iter_max_ * dt <= dt_max * (1.0 + 1e-9)) {
+        n_steps_per_iter_max_ *= 2;
+      }
+    }
+  }
   // Log parameters
   Log("\n");
   Log("  System variables calculated post-initialization:\n");
@@ -252,6 +276,7 @@ void Curator::InitializeSimulation() {
   Log("   n_steps_equil = %zu\n", n_steps_equil_);
   Log("   n_steps_per_snapshot = %zu\n", n_steps_per_snapshot_);
   Log("   n_datapoints = %zu\n", n_steps_run_ / n_steps_per_snapshot_);
+  Log("   n_steps_per_iter_max = %zu\n", n_steps_per_iter_max_);
   Log("\n");
   // Initialize sim objects
   SysRNG::Initialize(seed);
@@ -342,8 +367,8 @@ void Curator::CheckPrintProgress() {
   using namespace Params;
   // Percent milestone; controls report frequency
   int p_report{10};
-  // Advance simulation forward one site (or 1 dt in real time)
-  i_step_++;
+  // Advance simulation forward by each step (1 dt) spanned by this iteration
+  i_step_ += n_steps_per_iter_;
   // If still equilibrating, report progress and check protein equil. status
   if (equilibrating_) {
     if (i_step_ == 1) {
@@ -370,7 +395,9 @@ void Curator::CheckPrintProgress() {
     if (n_steps_so_far == 1) {
       Log("Data collection is 0%% complete.\n");
     }
-    if (n_steps_so_far % (n_steps_run_ / (100 / p_report)) == 0) {
+    // Iterations may span several steps; report once a milestone is passed
+    if (n_steps_so_far % (n_steps_run_ / (100 / p_report)) <
+        n_steps_per_iter_) {
       Log("Data collection is %g%% complete. (step #%zu | t = %g s)\n",
           double(n_steps_so_far) / n_steps_run_ * 100, i_step_, i_step_ * dt);
     }
@@ -382,6 +409,8 @@ void Curator::CheckPrintProgress() {
     size_t ticks_per_second{SysClock::period::den};
     Log("Simulation complete. Total time to execute: %.2f s\n",
         double(clock_ticks) / ticks_per_second);
+    Log("   Peak scratch memory per iteration: %zu bytes\n",
+        scratch_.GetPeakUsage());
   }
 }
 
@@ -392,11 +421,13 @@ void Curator::OutputData() {
   }
   Sys::i_datapoint_++;
   for (auto &&pf : filaments_.proto_) {
+    Vec2 pos1{pf.plus_end_->GetPosition()};
+    Vec2 pos2{pf.minus_end_->GetPosition()};
     double coord1[_n_dims_max];
     double coord2[_n_dims_max];
     for (int i_dim{0}; i_dim < _n_dims_max; i_dim++) {
-      coord1[i_dim] = (double)pf.plus_end_->pos_[i_dim];
-      coord2[i_dim] = (double)pf.minus_end_->pos_[i_dim];
+      coord1[i_dim] = pos1[i_dim];
+      coord2[i_dim] = pos2[i_dim];
     }
     // printf("wrote plus_end = (%g, %g)\n", coord1[0], coord1[1]);
     // printf("wrote minus_end = (%g, %g)\n", coord2[0], coord2[1]);
@@ -405,11 +436,11 @@ void Curator::OutputData() {
     if (!proteins_.motors_.active_ and !proteins_.xlinks_.active_) {
       continue;
     }
-    int occupancy[n_sites_max_];
-    int protein_id[n_sites_max_];
-    int partner_index[n_sites_max_];
-    bool motor_trailing[n_sites_max_];
-    double tether_anchor_pos[n_sites_max_];
+    int *occupancy{Sys::scratch_.Allocate<int>(n_sites_max_)};
+    int *protein_id{Sys::scratch_.Allocate<int>(n_sites_max_)};
+    int *partner_index{Sys::scratch_.Allocate<int>(n_sites_max_)};
+    bool *motor_trailing{Sys::scratch_.Allocate<bool>(n_sites_max_)};
+    double *tether_anchor_pos{Sys::scratch_.Allocate<double>(n_sites_max_)};
     for (int i_site{0}; i_site < n_sites_max_; i_site++) {
       occupancy[i_site] = _id_site;
       protein_id[i_site] = -1;
@@ -417,20 +448,18 @@ void Curator::OutputData() {
       motor_trailing[i_site] = false;
       tether_anchor_pos[i_site] = -1.0;
     }
-    for (auto const &site : pf.sites_) {
-      if (site.occupant_ == nullptr) {
-        continue;
-      }
-      const size_t species_id{site.occupant_->GetSpeciesID()};
-      occupancy[site.index_] = species_id;
-      protein_id[site.index_] = site.occupant_->GetID();
+    // Only visit occupied sites; see Protofilament::ForEachSite()
+    pf.ForEachOccupied([&](BindingSite *site) {
+      const size_t species_id{site->occupant_->GetSpeciesID()};
+      occupancy[site->index_] = species_id;
+      protein_id[site->index_] = site->occupant_->GetID();
       if (species_id == _id_xlink) {
-        if (site.occupant_->parent_->n_heads_active_ == 2) {
-          partner_index[site.index_] =
-              site.occupant_->GetOtherHead()->site_->index_;
+        if (site->occupant_->parent_->n_heads_active_ == 2) {
+          partner_index[site->index_] =
+              site->occupant_->GetOtherHead()->site_->index_;
         }
       } else if (species_id == _id_motor) {
-        motor_trailing[site.index_] = site.occupant_->Trailing();
+        motor_trailing[site->index_] = site->occupant_->Trailing();
         /*
         if (site.occupant_->parent_->tethered_) {
           auto partner{site.occupant_->parent_->partner_};
@@ -441,7 +470,7 @@ void Curator::OutputData() {
         }
         */
       }
-    }
+    });
     data_files_.at("occupancy").Write(occupancy, n_sites_max_);
     data_files_.at("protein_id").Write(protein_id, n_sites_max_);
     if (proteins_.xlinks_.crosslinking_active_) {
@@ -457,3 +486,54 @@ void Curator::OutputData() {
     data_files_.at("tether_anchor_pos").Write(tether_anchor_pos, n_sites_max_);
   }
 }
+
+void Curator::UpdateTimestep() {
+
+  using namespace Sys;
+  if (equilibrating_ or !running_) {
+    return;
+  }
+  // Never step past a snapshot (or the end of the run) so output stays aligned
+  size_t n_steps_max{n_steps_per_snapshot_ - i_step_ % n_steps_per_snapshot_};
+  n_steps_max = std::min(n_steps_max, n_steps_run_ + n_steps_equil_ - i_step_);
+  // If dt is fixed, idle steps can be skipped so long as nothing else happens
+  if (n_steps_per_iter_max_ == 1) {
+    n_steps_per_iter_ = 1;
+    n_steps_max = std::min(n_steps_max, filaments_.GetNumStepsImmobile());
+    for (size_t i_switch : {proteins_.motors_.step_active_,
+                            proteins_.xlinks_.step_active_, ablation_step_}) {
+      if (i_switch > i_step_) {
+        n_steps_max = std::min(n_steps_max, i_switch - i_step_);
+      }
+    }
+    n_steps_skip_max_ = std::max(n_steps_max, size_t(1));
+    return;
+  }
+  // Periodically adjust dt based on the statistics of the leaping engine
+  if (++i_iter_adapt_ >= n_iters_per_adapt_) {
+    i_iter_adapt_ = 0;
+    // Both quantities scale (approx.) linearly with the timestep
+    double p_step{proteins_.kmc_.GetMaxProbPerEntry() / n_steps_per_iter_};
+    double f_conflict{proteins_.kmc_.GetConflictFraction() / n_steps_per_iter_};
+    size_t n_goal{n_steps_per_iter_goal_};
+    if (p_step * n_goal > Params::p_step_max or
+        f_conflict * n_goal > Params::conflict_frac_max) {
+      n_steps_per_iter_goal_ = std::max(n_goal / 2, size_t(1));
+    } else if (2 * n_goal <= n_steps_per_iter_max_ and
+               p_step * 2 * n_goal <= Params::p_step_max and
+               f_conflict * 2 * n_goal <= Params::conflict_frac_max) {
+      n_steps_per_iter_goal_ = 2 * n_goal;
+    }
+    if (n_steps_per_iter_goal_ != n_goal) {
+      Log(1, "Timestep set to %g s (step #%zu)\n",
+          n_steps_per_iter_goal_ * Params::dt, i_step_);
+    }
+  }
+  size_t n_steps{std::min(n_steps_per_iter_goal_, n_steps_max)};
+  if (n_steps == n_steps_per_iter_) {
+    return;
+  }
+  n_steps_per_iter_ = n_steps;
+  proteins_.kmc_.SetTimestep(n_steps);
+  filaments_.SetTimestep(n_steps * Params::dt);
+}
@@ -9,10 +9,15 @@
 
 class Curator {
 private:
-  Vec<Str> test_modes_{"xlink_bind_ii",       "xlink_diffusion",
-                       "motor_lattice_bind",  "motor_lattice_step",
-                       "filament_separation", "filament_ablation",
-                       "hetero_tubulin",      "kinesin_mutant"};
+  Vec<std::pair<Str, Sys::TestMode>> test_modes_{
+      {"xlink_bind_ii", Sys::TestMode::XlinkBindII},
+      {"xlink_diffusion", Sys::TestMode::XlinkDiffusion},
+      {"motor_lattice_bind", Sys::TestMode::MotorLatticeBind},
+      {"motor_lattice_step", Sys::TestMode::MotorLatticeStep},
+      {"filament_separation", Sys::TestMode::FilamentSeparation},
+      {"filament_ablation", Sys::TestMode::FilamentAblation},
+      {"hetero_tubulin", Sys::TestMode::HeteroTubulin},
+      {"kinesin_mutant", Sys::TestMode::KinesinMutant}};
   // Vec<Str> demo_modes_{"filament_separation", "heterogenous_tubulin",
   //                      "kinesin_heterodimer"};
   struct DataFile {
@@ -39,6 +44,11 @@ private:
   UMap<Str, DataFile> data_files_;
   size_t n_steps_per_snapshot_{0};
   size_t n_sites_max_{0};
+  // Adaptive timestep; each iteration spans a power-of-2 multiple of dt
+  size_t n_iters_per_adapt_{100}; // # of iterations between dt adjustments
+  size_t i_iter_adapt_{0};
+  size_t n_steps_per_iter_max_{1}; // Set by dt_max; 1 if adaptive dt is off
+  size_t n_steps_per_iter_goal_{1};
 
   SysTimepoint start_time_;
 
@@ -55,6 +65,7 @@ private:
 
   void CheckPrintProgress();
   void OutputData();
+  void UpdateTimestep();
 
 public:
   Curator(int argc, char *argv[]) {
@@ -65,10 +76,12 @@ public:
     GenerateDataFiles();
   }
   void EvolveSimulation() {
+    Sys::scratch_.Reset();
     proteins_.RunKMC();
     filaments_.RunBD();
     CheckPrintProgress();
     OutputData();
+    UpdateTimestep();
   }
 };
 #endif
\ No newline at end of file
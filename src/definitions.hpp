@@ -1,10 +1,14 @@
 #ifndef _CYLAKS_DEFINITIONS_HPP_
 #define _CYLAKS_DEFINITIONS_HPP_
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <functional>
 #include <map>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -25,9 +29,12 @@ inline static const size_t _id_motor{2};
 inline static const double _r_site{8.0};
 inline static const double _r_xlink_head{4.0};
 inline static const double _r_motor_head{4.0};
+/* Fixed-size vector & matrix in the lab frame; no heap allocation */
+using Vec2 = std::array<double, _n_dims_max>;
+using Mat2 = std::array<Vec2, _n_dims_max>;
 /* Lab frame coordinate vectors */
-inline static const std::vector<double> _x_hat{1.0, 0.0};
-inline static const std::vector<double> _y_hat{0.0, 1.0};
+inline static constexpr Vec2 _x_hat{1.0, 0.0};
+inline static constexpr Vec2 _y_hat{0.0, 1.0};
 
 /* Stylistic stuff */
 using Str = std::string;
@@ -39,10 +46,27 @@ template <typename DATA_T> using Vec3D = Vec<Vec<Vec<DATA_T>>>;
 template <typename DATA_T> using Vec4D = Vec<Vec<Vec<Vec<DATA_T>>>>;
 template <typename DATA_T> using Vec5D = Vec<Vec<Vec<Vec<Vec<DATA_T>>>>>;
 template <typename DATA_T> using Fn = std::function<DATA_T>;
+template <typename DATA_T> using UPtr = std::unique_ptr<DATA_T>;
 template <typename T1, typename T2> using Map = std::map<T1, T2>;
 template <typename T1, typename T2> using UMap = std::unordered_map<T1, T2>;
 template <typename T1, typename T2> using Pair = std::pair<T1, T2>;
 
+/* Fixed-capacity vector; lives wherever its owner does & never allocates */
+template <typename DATA_T, size_t CAPACITY> struct FixedVec {
+  size_t size_{0};
+  std::array<DATA_T, CAPACITY> data_;
+  void push_back(DATA_T val) {
+    assert(size_ < CAPACITY);
+    data_[size_++] = val;
+  }
+  void clear() { size_ = 0; }
+  bool empty() const { return size_ == 0; }
+  size_t size() const { return size_; }
+  DATA_T const &operator[](size_t i) const { return data_[i]; }
+  DATA_T const *begin() const { return data_.data(); }
+  DATA_T const *end() const { return data_.data() + size_; }
+};
+
 /* Common macros */
 inline double Square(double x) { return x * x; }
 inline double Cube(double x) { return x * x * x; }
@@ -62,16 +86,14 @@ template <typename... ARGS> inline double Avg(ARGS... vals) {
   }
   return sum / sizeof...(vals);
 }
-inline double Dot(Vec<double> a, Vec<double> b) {
-  assert(a.size() == b.size());
-  assert(a.size() <= _n_dims_max);
+inline constexpr double Dot(Vec2 const &a, Vec2 const &b) {
   double dotprod{0.0};
-  for (int i_dim{0}; i_dim < a.size(); i_dim++) {
+  for (int i_dim{0}; i_dim < _n_dims_max; i_dim++) {
     dotprod += a[i_dim] * b[i_dim];
   }
   return dotprod;
 }
-inline double Dot(Vec<double> a, int i_dim) {
+inline constexpr double Dot(Vec2 const &a, int i_dim) {
   switch (i_dim) {
   case 0:
     return Dot(a, _x_hat);
@@ -81,27 +103,29 @@ inline double Dot(Vec<double> a, int i_dim) {
   return NAN;
 }
 // Pseudo cross-product in 2-D (torque is a scalar; in/out of page)
-inline double Cross(Vec<double> a, Vec<double> b) {
+inline constexpr double Cross(Vec2 const &a, Vec2 const &b) {
   return a[0] * b[1] - a[1] * b[0];
 }
-inline Vec<double> Cross(double a, Vec<double> b) {
+inline constexpr Vec2 Cross(double a, Vec2 const &b) {
   return {-a * b[1], a * b[0]};
 }
-inline Vec<double> Cross(Vec<double> a, double b) {
+inline constexpr Vec2 Cross(Vec2 const &a, double b) {
   return {b * a[1], -b * a[0]};
 }
-inline Vec2D<double> Outer(Vec<double> a, Vec<double> b) {
-  Vec2D<double> matrix(a.size(), Vec<double>(b.size(), 0.0));
-  for (int i{0}; i < a.size(); i++) {
-    for (int j{0}; j < b.size(); j++) {
+inline constexpr Mat2 Outer(Vec2 const &a, Vec2 const &b) {
+  Mat2 matrix{};
+  for (int i{0}; i < _n_dims_max; i++) {
+    for (int j{0}; j < _n_dims_max; j++) {
       matrix[i][j] = a[i] * b[j];
     }
   }
   return matrix;
 }
-inline Vec2D<double> GetProjectionMatrix(Vec<double> a) { return Outer(a, a); }
-inline Vec2D<double> GetOrthonormalBasis(Vec<double> a) {
-  return {{a[0], a[1]}, {a[1], -a[0]}};
+inline constexpr Mat2 GetProjectionMatrix(Vec2 const &a) {
+  return Outer(a, a);
+}
+inline constexpr Mat2 GetOrthonormalBasis(Vec2 const &a) {
+  return {Vec2{a[0], a[1]}, Vec2{a[1], -a[0]}};
 }
 
 #endif
\ No newline at end of file
@@ -1,18 +1,14 @@
 #include "event.hpp"
 
-void Event::SampleStatistics_Poisson() {
+void Event::SampleStatistics_Poisson(double p_occur) {
 
   // printf("WHY\n");
-  if (*n_avail_ > poisson_.weights_.size()) {
-    poisson_.weights_.resize(*n_avail_);
+  UpdateWeights_Poisson();
+  n_expected_ = SampleDist(weights_.GetTotal() * p_occur, 0);
+  // Correct statistics if n_expected > n_candidates (non-zero weights)
+  if (n_expected_ > weights_.n_nonzero_) {
+    n_expected_ = weights_.n_nonzero_;
   }
-  poisson_.weight_total_ = 0.0;
-  for (int i_entry{0}; i_entry < *n_avail_; i_entry++) {
-    poisson_.weights_[i_entry] =
-        poisson_.get_weight_(target_pool_->at(i_entry));
-    poisson_.weight_total_ += poisson_.weights_[i_entry];
-  }
-  n_expected_ = prob_dist_(poisson_.weight_total_ * p_occur_, 0);
   if (n_expected_ > 0) {
     SetTargets_Poisson();
   }
@@ -20,48 +16,124 @@ void Event::SampleStatistics_Poisson() {
 
 void Event::SetTargets_Poisson() {
 
-  // Run through potential candidates and remove those with weight = 0.0
-  for (int i_entry{0}; i_entry < *n_avail_; i_entry++) {
-    if (poisson_.weights_[i_entry] == 0.0) {
-      size_t i_last{--*n_avail_};
-      if (*n_avail_ == 0) {
-        n_expected_ = 0;
-        return;
-      }
-      target_pool_->at(i_entry) = target_pool_->at(i_last);
-      poisson_.weights_[i_entry] = poisson_.weights_[i_last];
-      i_entry--;
-    }
+  if (n_expected_ > targets_.size()) {
+    targets_.resize(n_expected_);
   }
-  // Correct statistics if n_expected > n_avail after above removal
-  if (n_expected_ > *n_avail_) {
-    n_expected_ = *n_avail_;
+  size_t *indices{Sys::scratch_.Allocate<size_t>(n_expected_)};
+  double *weights{Sys::scratch_.Allocate<double>(n_expected_)};
+  // Select n_expected_ entries at random, weighted w/o replacement
+  for (int i_set{0}; i_set < n_expected_; i_set++) {
+    double ran{SysRNG::GetRanProb(SysRNG::Selection)};
+    size_t i_entry{weights_.Find(ran * weights_.GetTotal())};
+    targets_[i_set] = GetTarget(i_entry);
+    // Temporarily zero out selected entry so it isn't reselected
+    indices[i_set] = i_entry;
+    weights[i_set] = weights_.Get(i_entry);
+    weights_.Set(i_entry, 0.0);
   }
-  // Scratch array that will hold selected targets before transfer
-  Object *selected_candidates[n_expected_];
-  // Select n_expected_ entries at random
   for (int i_set{0}; i_set < n_expected_; i_set++) {
-    double p_cum{0.0};
-    double ran{SysRNG::GetRanProb()};
-    for (int i_entry{0}; i_entry < *n_avail_; i_entry++) {
-      p_cum += poisson_.weights_[i_entry] / poisson_.weight_total_;
-      if (ran < p_cum) {
-        // Add entry to selected candidates
-        selected_candidates[i_set] = target_pool_->at(i_entry);
-        // Remove selected candidate from target pool so it isn't selected again
-        poisson_.weight_total_ -= poisson_.weights_[i_entry];
-        size_t i_last{--*n_avail_};
-        target_pool_->at(i_entry) = target_pool_->at(i_last);
-        poisson_.weights_[i_entry] = poisson_.weights_[i_last];
-        break;
-      }
-    }
+    weights_.Set(indices[i_set], weights[i_set]);
+  }
+  SetOutcomes();
+}
+
+double Event::GetMaxProbPerEntry() {
+
+  // Poisson-mode weights reflect the most recent call to SampleStatistics()
+  if (mode_ == Poisson) {
+    return weights_.GetMax() * p_occur_;
+  }
+  // Binomial-mode entries all share p_occur_, even if none are available yet
+  return p_occur_;
+}
+
+void Event::SetSampleInterval(size_t n_steps_max, double p_max) {
+
+  // Sample as rarely as possible while keeping per-entry probabilities small
+  // Weights of Poisson-mode events vary, so use the largest seen thus far
+  p_entry_max_ = std::max(p_entry_max_, GetMaxProbPerEntry());
+  n_steps_per_sample_ = 1;
+  if (p_entry_max_ == 0.0) {
+    return;
+  }
+  while (2 * n_steps_per_sample_ <= n_steps_max and
+         2 * n_steps_per_sample_ * p_entry_max_ <= p_max) {
+    n_steps_per_sample_ *= 2;
+  }
+}
+
+void Event::RecordOpportunities(size_t n_steps) {
+
+  n_opportunities_tot_ += n_steps * *n_avail_;
+  // Distributions aren't sampled in continuous time (or when skipping ahead),
+  // but are still invoked each timestep so that any bookkeeping they do
+  // (e.g., in test modes) is kept
+  for (size_t i_step{0}; i_step < n_steps; i_step++) {
+    SampleDist(0.0, 0);
+  }
+}
+
+double Event::GetPropensity() {
+
+  // Expected # of occurrences per timestep, i.e., total rate * dt
+  if (mode_ == Poisson) {
+    UpdateWeights_Poisson();
+    return weights_.GetTotal() * p_occur_;
+  }
+  return *n_avail_ * p_occur_;
+}
+
+void Event::ExecuteSingle() {
+
+  // Poisson-mode weights are assumed to be current, i.e., GetPropensity()
+  // must be called beforehand without any intermediate updates
+  size_t i_entry;
+  if (mode_ == Poisson) {
+    i_entry = weights_.Find(SysRNG::GetRanProb(SysRNG::Selection) * weights_.GetTotal());
+  } else {
+    i_entry = SysRNG::GetRanInt(*n_avail_);
+  }
+  Object *target{GetTarget(i_entry)};
+  size_t i_outcome{fused_ ? ChooseOutcome(target) : 0};
+  Execute(target, i_outcome);
+  RecordExecution(i_outcome);
+}
+
+double Event::GetLogProbIdle() {
+
+  // Log of the probability that this event does not occur within a timestep
+  if (mode_ == Poisson) {
+    UpdateWeights_Poisson();
+    return -weights_.GetTotal() * p_occur_;
   }
-  // Set n_avail_ to n_expected_ so that SetTargets() only sees selected
-  // candidates; will be updated next timestep regardless
-  *n_avail_ = n_expected_;
-  // Transfer selected candidates into target pool
-  for (int i_entry{0}; i_entry < *n_avail_; i_entry++) {
-    target_pool_->at(i_entry) = selected_candidates[i_entry];
+  return *n_avail_ * std::log1p(-p_occur_);
+}
+
+size_t Event::SampleStatistics_NoDist(bool nonzero) {
+
+  // Samples the underlying binomial or Poisson distribution directly, i.e.,
+  // w/o the bookkeeping done by SampleDist(); see RecordOpportunities()
+  if (mode_ == Poisson) {
+    double n_avg{weights_.GetTotal() * p_occur_};
+    if (nonzero) {
+      n_expected_ = SysRNG::SamplePoisson_NonZero(n_avg);
+    } else {
+      n_expected_ = n_avg > 0.0 ? SysRNG::SamplePoisson(n_avg) : 0;
+    }
+    if (n_expected_ > weights_.n_nonzero_) {
+      n_expected_ = weights_.n_nonzero_;
+    }
+    if (n_expected_ > 0) {
+      SetTargets_Poisson();
+    }
+  } else {
+    if (nonzero) {
+      n_expected_ = SysRNG::SampleBinomial_NonZero(p_occur_, *n_avail_);
+    } else {
+      n_expected_ =
+          *n_avail_ > 0 ? SysRNG::SampleBinomial(p_occur_, *n_avail_) : 0;
+    }
+    SetTargets();
   }
+  return n_expected_;
 }
@@ -1,80 +1,267 @@
 #ifndef _CYLAKS_EVENT_HPP_
 #define _CYLAKS_EVENT_HPP_
 #include "definitions.hpp"
+#include "population.hpp"
+#include "sum_tree.hpp"
 #include "system_rng.hpp"
 
 class Object;
 
+// Bookkeeping shared by all events; the actual kinetics (sampling, weighting,
+// and execution) of each event are provided by an EventKernel (see below)
 struct Event {
-private:
+protected:
   enum Distribution { Binomial, Poisson };
-  Distribution mode_{Binomial};    // Which distribution we sample from
-  Vec<Object *> *target_pool_;     // Ptr to list of available targets; dynamic
-  Fn<void(Object *)> exe_;         // Function that actually executes this event
-  Fn<int(double, int)> prob_dist_; // Sampled to predict n_events each timestep
-  struct PoissonToolbox {
-    double weight_total_;
-    Vec<double> weights_;
-    Fn<double(Object *)> get_weight_;
-  };
-  PoissonToolbox poisson_; // Auxiliary resources for poisson mode
+  Distribution mode_{Binomial}; // Which distribution we sample from
+  WeightFlags *flags_{nullptr}; // Poisson mode; which weights need updating
+  SumTree weights_;             // Poisson mode; weight of each target
 
 public:
   size_t n_executed_tot_{0};      // # of times event has been executed
   size_t n_opportunities_tot_{0}; // # of opportunities event had to execute
   Str name_{"bruh"};              // Name of this event, e.g., "Bind_II_Teth"
   double p_occur_{0.0};      // Probability that event will occur each timestep
+  double p_base_{0.0};       // p_occur_ for a single dt; see SetTimestep()
+  // Multi-rate; slow events are sampled less often; see SetSampleInterval()
+  size_t n_steps_per_sample_{1}; // # of timesteps leaped over per sample
+  size_t n_steps_unsampled_{0};  // # of timesteps since last sample
+  double p_entry_max_{0.0};      // Largest per-entry probability seen
   size_t n_expected_{0};     // Expected # of events to occur any given timestep
   size_t *n_avail_{nullptr}; // Ptr to # of targets event can act on; dynamic
   Vec<Object *> targets_;    // Objects this event will act on this timestep
+  // Fused events; each target undergoes one of several exclusive outcomes
+  bool fused_{false};
+  Vec<Str> outcome_names_;         // [i_outcome]; appended to name_ in stats
+  Vec<size_t> n_executed_outcome_; // [i_outcome]
+  Vec<size_t> outcomes_;           // [i_target]; outcome of each target
 
-private:
+protected:
   void SetTargets() {
     if (n_expected_ > targets_.size()) {
       targets_.resize(n_expected_);
     }
-    int indices[n_expected_];
+    int *indices{Sys::scratch_.Allocate<int>(n_expected_)};
     SysRNG::SetRanIndices(indices, n_expected_, *n_avail_);
     for (int i_entry{0}; i_entry < n_expected_; i_entry++) {
-      targets_[i_entry] = target_pool_->at(indices[i_entry]);
+      targets_[i_entry] = GetTarget(indices[i_entry]);
+    }
+    SetOutcomes();
+  }
+  void SetOutcomes() {
+    if (!fused_) {
+      return;
+    }
+    if (n_expected_ > outcomes_.size()) {
+      outcomes_.resize(n_expected_);
+    }
+    for (int i_entry{0}; i_entry < n_expected_; i_entry++) {
+      outcomes_[i_entry] = ChooseOutcome(targets_[i_entry]);
     }
   }
-  void SampleStatistics_Poisson();
+  void SampleStatistics_Poisson(double p_occur);
   void SetTargets_Poisson();
+  // Called once per event per timestep
+  virtual Object *GetTarget(size_t i_entry) = 0;
+  virtual int SampleDist(double p, int n) = 0;
+  virtual void UpdateWeights_Poisson() = 0;
+  // Called once per execution; i_outcome is always 0 unless fused
+  virtual void Execute(Object *target, size_t i_outcome) = 0;
+  virtual size_t ChooseOutcome(Object *target) { return 0; }
 
 public:
-  Event(Str name, double p_occur, size_t *n_avail, Vec<Object *> *target_pool,
-        Fn<int(double, int)> prob_dist, Fn<void(Object *)> exe)
-      : name_{name}, p_occur_{p_occur}, n_avail_{n_avail},
-        target_pool_{target_pool}, prob_dist_{prob_dist}, exe_{exe} {}
-  Event(Str name, double p_occur, size_t *n_avail, Vec<Object *> *target_pool,
-        Fn<int(double, int)> prob_dist, Fn<double(Object *)> weight_fn,
-        Fn<void(Object *)> exe)
-      : Event(name, p_occur, n_avail, target_pool, prob_dist, exe) {
-    poisson_.get_weight_ = weight_fn;
+  Event(Str name, double p_occur, size_t *n_avail)
+      : name_{name}, p_occur_{p_occur}, p_base_{p_occur}, n_avail_{n_avail} {}
+  template <typename ENTRY_T, typename MEMBER_T>
+  Event(Str name, double p_occur, Population<ENTRY_T, MEMBER_T> *pop)
+      : Event(name, p_occur, &pop->size_) {
+    pop->EnableWeights();
+    flags_ = pop;
     mode_ = Poisson;
   }
+  virtual ~Event() {}
   size_t SampleStatistics() {
     n_opportunities_tot_ += *n_avail_;
+    if (++n_steps_unsampled_ < n_steps_per_sample_) {
+      n_expected_ = 0;
+      return n_expected_;
+    }
+    // Probability of occurring at least once over all unsampled timesteps
+    double p_occur{p_occur_ * n_steps_unsampled_};
+    n_steps_unsampled_ = 0;
     if (mode_ == Poisson) {
-      SampleStatistics_Poisson();
+      SampleStatistics_Poisson(p_occur);
     } else {
-      n_expected_ = prob_dist_(p_occur_, *n_avail_);
+      n_expected_ = SampleDist(std::min(p_occur, 1.0), *n_avail_);
+      SetTargets();
     }
-    SetTargets();
     return n_expected_;
   }
-  void RemoveTarget(Object *tar) {
-    for (int i_entry{0}; i_entry < n_expected_; i_entry++) {
-      if (tar == targets_[i_entry]) {
-        targets_[i_entry] = targets_[--n_expected_];
-        return;
+  void Execute() {
+    n_expected_--;
+    size_t i_outcome{fused_ ? outcomes_[n_expected_] : 0};
+    Execute(targets_[n_expected_], i_outcome);
+    RecordExecution(i_outcome);
+  }
+  void RecordExecution(size_t i_outcome) {
+    n_executed_tot_++;
+    if (fused_) {
+      n_executed_outcome_[i_outcome]++;
+    }
+  }
+  // Adaptive timestep; each KMC iteration spans n_steps * dt
+  void SetTimestep(size_t n_steps) {
+    p_occur_ = p_base_ * n_steps;
+    p_entry_max_ = 0.0;
+    n_steps_per_sample_ = 1;
+  }
+  double GetMaxProbPerEntry();
+  void SetSampleInterval(size_t n_steps_max, double p_max);
+  // Continuous-time (BKL) engine and idle-step skip-ahead; see EventManager
+  void RecordOpportunities(size_t n_steps = 1);
+  double GetPropensity();
+  void ExecuteSingle();
+  double GetLogProbIdle();
+  size_t SampleStatistics_NoDist(bool nonzero);
+};
+
+// Placeholder weight for binomial-mode events, which are never weighted
+struct Unweighted {
+  template <typename TARGET_T, typename... ARGS>
+  double operator()(TARGET_T *target, ARGS... args) const {
+    return 1.0;
+  }
+};
+
+// Concrete event type; callables are stored by value and invoked directly
+// with the target's actual type, so they can be inlined into the KMC loop
+template <typename TARGET_T, typename DIST_T, typename EXE_T,
+          typename WEIGHT_T = Unweighted, typename POOL_T = Vec<TARGET_T *>>
+class EventKernel : public Event {
+private:
+  POOL_T *target_pool_;  // Ptr to list (or bin) of available targets; dynamic
+  DIST_T prob_dist_;     // Sampled to predict n_events each timestep
+  EXE_T exe_;            // Function that actually executes this event
+  WEIGHT_T get_weight_;  // Relative weight of each target; Poisson only
+
+private:
+  Object *GetTarget(size_t i_entry) { return (*target_pool_)[i_entry]; }
+  int SampleDist(double p, int n) { return prob_dist_(p, n); }
+  void UpdateWeights_Poisson() {
+    weights_.Resize(*n_avail_);
+    // Only re-evaluate weights of entries that have changed since last step
+    if (flags_->all_flagged_) {
+      weights_.SetAll([&](size_t i_entry) {
+        return get_weight_((*target_pool_)[i_entry]);
+      });
+    } else {
+      for (auto const &i_entry : flags_->flagged_slots_) {
+        if (i_entry < *n_avail_) {
+          weights_.Set(i_entry, get_weight_((*target_pool_)[i_entry]));
+        }
       }
     }
+    flags_->ClearFlaggedWeights();
   }
-  void Execute() {
-    exe_(targets_[--n_expected_]);
-    n_executed_tot_++;
+  void Execute(Object *target, size_t i_outcome) {
+    exe_(static_cast<TARGET_T *>(target));
+  }
+
+public:
+  EventKernel(Str name, double p_occur, size_t *n_avail, POOL_T *target_pool,
+              DIST_T prob_dist, EXE_T exe)
+      : Event(name, p_occur, n_avail), target_pool_{target_pool},
+        prob_dist_{prob_dist}, exe_{exe}, get_weight_{Unweighted()} {}
+  template <typename ENTRY_T>
+  EventKernel(Str name, double p_occur, Population<ENTRY_T, TARGET_T> *pop,
+              DIST_T prob_dist, WEIGHT_T weight_fn, EXE_T exe)
+      : Event(name, p_occur, pop), target_pool_{&pop->entries_},
+        prob_dist_{prob_dist}, exe_{exe}, get_weight_{weight_fn} {}
+};
+
+// Event whose targets each undergo one of several mutually exclusive outcomes
+// (e.g., stepping forward or backward), drawn jointly from a single pool;
+// the rate of outcome k for a given target is p_k * get_weight_(target, k)
+template <typename TARGET_T, typename DIST_T, typename EXE_T,
+          typename WEIGHT_T = Unweighted, typename POOL_T = Vec<TARGET_T *>>
+class FusedEventKernel : public Event {
+private:
+  POOL_T *target_pool_;  // Ptr to list (or bin) of available targets; dynamic
+  DIST_T prob_dist_;     // Sampled to predict n_events each timestep
+  EXE_T exe_;            // Called as exe_(target, i_outcome)
+  WEIGHT_T get_weight_;  // Called as get_weight_(target, i_outcome)
+  Vec<double> shares_;   // [i_outcome]; p_k as a fraction of p_occur_
+
+private:
+  void InitializeOutcomes(Vec<std::pair<Str, double>> const &outcomes) {
+    fused_ = true;
+    p_occur_ = 0.0;
+    for (auto const &outcome : outcomes) {
+      outcome_names_.push_back(outcome.first);
+      p_occur_ += outcome.second;
+    }
+    for (auto const &outcome : outcomes) {
+      shares_.push_back(p_occur_ > 0.0 ? outcome.second / p_occur_
+                                       : 1.0 / outcomes.size());
+    }
+    p_base_ = p_occur_;
+    n_executed_outcome_.resize(outcomes.size());
+  }
+  // Combined weight of a target, i.e., its total rate divided by p_occur_
+  double GetWeight(TARGET_T *target) {
+    double weight{0.0};
+    for (size_t i_outcome{0}; i_outcome < shares_.size(); i_outcome++) {
+      weight += shares_[i_outcome] * get_weight_(target, i_outcome);
+    }
+    return weight;
+  }
+  Object *GetTarget(size_t i_entry) { return (*target_pool_)[i_entry]; }
+  int SampleDist(double p, int n) { return prob_dist_(p, n); }
+  void UpdateWeights_Poisson() {
+    weights_.Resize(*n_avail_);
+    if (flags_->all_flagged_) {
+      weights_.SetAll(
+          [&](size_t i_entry) { return GetWeight((*target_pool_)[i_entry]); });
+    } else {
+      for (auto const &i_entry : flags_->flagged_slots_) {
+        if (i_entry < *n_avail_) {
+          weights_.Set(i_entry, GetWeight((*target_pool_)[i_entry]));
+        }
+      }
+    }
+    flags_->ClearFlaggedWeights();
+  }
+  size_t ChooseOutcome(Object *target) {
+    TARGET_T *tar{static_cast<TARGET_T *>(target)};
+    double ran{SysRNG::GetRanProb(SysRNG::Selection) * GetWeight(tar)};
+    size_t i_last{shares_.size() - 1};
+    for (size_t i_outcome{0}; i_outcome < i_last; i_outcome++) {
+      double weight{shares_[i_outcome] * get_weight_(tar, i_outcome)};
+      if (ran < weight) {
+        return i_outcome;
+      }
+      ran -= weight;
+    }
+    return i_last;
+  }
+  void Execute(Object *target, size_t i_outcome) {
+    exe_(static_cast<TARGET_T *>(target), i_outcome);
+  }
+
+public:
+  FusedEventKernel(Str name, Vec<std::pair<Str, double>> const &outcomes,
+                   size_t *n_avail, POOL_T *target_pool, DIST_T prob_dist,
+                   EXE_T exe)
+      : Event(name, 0.0, n_avail), target_pool_{target_pool},
+        prob_dist_{prob_dist}, exe_{exe}, get_weight_{Unweighted()} {
+    InitializeOutcomes(outcomes);
+  }
+  template <typename ENTRY_T>
+  FusedEventKernel(Str name, Vec<std::pair<Str, double>> const &outcomes,
+                   Population<ENTRY_T, TARGET_T> *pop, DIST_T prob_dist,
+                   WEIGHT_T weight_fn, EXE_T exe)
+      : Event(name, 0.0, pop), target_pool_{&pop->entries_},
+        prob_dist_{prob_dist}, exe_{exe}, get_weight_{weight_fn} {
+    InitializeOutcomes(outcomes);
   }
 };
-#endif
\ No newline at end of file
+#endif
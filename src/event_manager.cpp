@@ -1,60 +1,93 @@
 #include "event_manager.hpp"
 #include "curator.hpp"
 #include "system_namespace.hpp"
+#include "system_parameters.hpp"
 #include "system_rng.hpp"
 
 EventManager::EventManager() {}
 
-void EventManager::Initialize() {}
+void EventManager::Initialize() {
+
+  continuous_ = (Params::kmc_engine == "continuous");
+  // Test modes rely on every event being sampled each timestep
+  if (Sys::test_mode_.empty()) {
+    n_steps_per_sample_max_ = Params::n_steps_per_sample_max;
+  }
+}
 
 void EventManager::SampleEventStatistics() {
 
   n_events_to_exe_ = 0;
   // printf("yes?\n");
   for (auto &&event : events_) {
-    // printf("event is %s\n", event.name_.c_str());
-    n_events_to_exe_ += event.SampleStatistics();
+    // printf("event is %s\n", event->name_.c_str());
+    n_events_to_exe_ += event->SampleStatistics();
+    if (n_steps_per_sample_max_ > 1 and event->n_steps_unsampled_ == 0) {
+      event->SetSampleInterval(n_steps_per_sample_max_, Params::p_step_max);
+    }
   }
   // printf("noh\n");
+  n_scheduled_tot_ += n_events_to_exe_;
   if (n_events_to_exe_ <= 1) {
     return;
   }
-  // Put all events with >1 target into an active_ array
-  Pair<Event *, Object *> active_events[n_events_to_exe_];
-  int i_active{0};
+  ResolveConflicts();
+}
+
+void EventManager::ResolveConflicts() {
+
+  // Put all events with >1 target into a flat list of (event, target) pairs
+  if (n_events_to_exe_ > scheduled_.size()) {
+    scheduled_.resize(n_events_to_exe_);
+  }
+  int i_scheduled{0};
   for (auto &&event : events_) {
-    // Add a ptr to the event for each target it has
-    for (int i_tar{0}; i_tar < event.n_expected_; i_tar++) {
-      active_events[i_active++] = std::make_pair(&event, event.targets_[i_tar]);
+    for (int i_tar{0}; i_tar < event->n_expected_; i_tar++) {
+      scheduled_[i_scheduled++] = {event.get(), event->targets_[i_tar],
+                                   false};
     }
   }
-  // Scan through all active events to ensure that no 2 target the same
+  // Single pass; each object ID is claimed by the first event to target it.
+  // If a later event targets the same motor or motor head, one is removed
+  i_sample_++;
   for (int i_entry{0}; i_entry < n_events_to_exe_; i_entry++) {
-    Event *event_i{active_events[i_entry].first};
-    Object *tar_i{active_events[i_entry].second};
-    for (int j_entry{i_entry + 1}; j_entry < n_events_to_exe_; j_entry++) {
-      Event *event_j{active_events[j_entry].first};
-      // wally_->Log(2, "   event_j = %s\n", event_j->name_.c_str());
-      Object *tar_j{active_events[j_entry].second};
-      // If event_i and event_j target the same motor or motor head, remove one
-      if (tar_i->GetID() == tar_j->GetID()) {
-        double p_one{event_i->p_occur_};
-        double p_two{event_j->p_occur_};
-        double ran{SysRNG::GetRanProb()};
-        if (ran < p_one / (p_one + p_two)) {
-          event_i->RemoveTarget(active_events[i_entry].second);
-          active_events[i_entry] = active_events[n_events_to_exe_ - 1];
-          i_entry--;
-          n_events_to_exe_--;
-          break;
-        } else {
-          event_j->RemoveTarget(active_events[j_entry].second);
-          active_events[j_entry] = active_events[n_events_to_exe_ - 1];
-          j_entry--;
-          n_events_to_exe_--;
+    size_t id{scheduled_[i_entry].target_->GetID()};
+    if (id >= claim_stamps_.size()) {
+      claim_stamps_.resize(std::max(id + 1, Sys::n_unique_objects_));
+      claim_holders_.resize(claim_stamps_.size());
+    }
+    if (claim_stamps_[id] != i_sample_) {
+      claim_stamps_[id] = i_sample_;
+      claim_holders_[id] = i_entry;
+      continue;
+    }
+    size_t j_entry{claim_holders_[id]};
+    double p_one{scheduled_[j_entry].event_->p_occur_};
+    double p_two{scheduled_[i_entry].event_->p_occur_};
+    double ran{SysRNG::GetRanProb(SysRNG::Selection)};
+    n_conflicts_tot_++;
+    if (ran < p_one / (p_one + p_two)) {
+      scheduled_[j_entry].removed_ = true;
+      claim_holders_[id] = i_entry;
+    } else {
+      scheduled_[i_entry].removed_ = true;
+    }
+  }
+  // Compact target lists of each event so that only winners remain
+  int i_entry{0};
+  n_events_to_exe_ = 0;
+  for (auto &&event : events_) {
+    size_t n_kept{0};
+    for (int i_tar{0}; i_tar < event->n_expected_; i_tar++) {
+      if (!scheduled_[i_entry++].removed_) {
+        if (event->fused_) {
+          event->outcomes_[n_kept] = event->outcomes_[i_tar];
         }
+        event->targets_[n_kept++] = event->targets_[i_tar];
       }
     }
+    event->n_expected_ = n_kept;
+    n_events_to_exe_ += n_kept;
   }
 }
 
@@ -63,30 +96,26 @@ void EventManager::GenerateExecutionSequence() {
   if (n_events_to_exe_ == 0) {
     return;
   }
+  if (n_events_to_exe_ > events_to_exe_.size()) {
+    events_to_exe_.resize(n_events_to_exe_);
+  }
+  // Sequence is built & shuffled in place; events_to_exe_ is never shrunk
   int i_array{0};
-  Event *pre_array[n_events_to_exe_];
   for (auto &&event : events_) {
-    for (int i_entry{0}; i_entry < event.n_expected_; i_entry++) {
-      pre_array[i_array++] = &event;
+    for (int i_entry{0}; i_entry < event->n_expected_; i_entry++) {
+      events_to_exe_[i_array++] = event.get();
     }
   }
   if (i_array != n_events_to_exe_) {
     Sys::ErrorExit("K_MGMT::GenerateExecutionSequence()");
   }
   if (n_events_to_exe_ > 1) {
-    SysRNG::Shuffle(pre_array, n_events_to_exe_, sizeof(Event *));
-  }
-  if (n_events_to_exe_ > events_to_exe_.size()) {
-    events_to_exe_.resize(n_events_to_exe_);
-  }
-  for (int i_event{0}; i_event < n_events_to_exe_; i_event++) {
-    events_to_exe_[i_event] = pre_array[i_event];
+    SysRNG::Shuffle(events_to_exe_.data(), n_events_to_exe_, sizeof(Event *));
   }
 }
 
-void EventManager::ExecuteEvents() {
+void EventManager::ExecuteSequence() {
 
-  SampleEventStatistics();
   GenerateExecutionSequence();
   // if (n_events_to_exe_ >= 1) {
   //   printf("%i EVENTS TO EXE\n", n_events_to_exe_);
@@ -97,4 +126,164 @@ void EventManager::ExecuteEvents() {
              events_to_exe_[i_event]->targets_[0]->GetID());
     events_to_exe_[i_event]->Execute();
   }
-}
\ No newline at end of file
+}
+
+void EventManager::ExecuteEvents() {
+
+  SampleEventStatistics();
+  ExecuteSequence();
+}
+
+size_t EventManager::ExecuteEvents_SkipAhead(size_t n_steps_max) {
+
+  if (events_.size() > log_p_idle_.size()) {
+    log_p_idle_.resize(events_.size());
+  }
+  double log_p_idle{0.0};
+  for (int i_event{0}; i_event < events_.size(); i_event++) {
+    log_p_idle_[i_event] = events_[i_event]->GetLogProbIdle();
+    log_p_idle += log_p_idle_[i_event];
+  }
+  if (log_p_idle < std::log(p_idle_min_)) {
+    ExecuteEvents();
+    return 1;
+  }
+  // Slow events (see Event::SetSampleInterval()) must catch up beforehand
+  bool caught_up{true};
+  for (auto &&event : events_) {
+    if (event->n_steps_unsampled_ > 0) {
+      event->n_steps_per_sample_ = 1;
+      caught_up = false;
+    }
+  }
+  if (!caught_up) {
+    ExecuteEvents();
+    return 1;
+  }
+  // # of idle steps before the next event is geometrically distributed
+  size_t n_idle{n_steps_max};
+  if (log_p_idle < 0.0) {
+    double n_draw{std::floor(std::log(SysRNG::GetRanProb(SysRNG::Kinetics)) / log_p_idle)};
+    if (n_draw < n_steps_max) {
+      n_idle = size_t(n_draw);
+    }
+  }
+  for (auto &&event : events_) {
+    event->RecordOpportunities(n_idle);
+  }
+  if (n_idle == n_steps_max) {
+    return n_idle;
+  }
+  // The following step must have at least one event; go thru events in order,
+  // each being the first to occur w/ prob. conditioned on the rest not doing so
+  n_events_to_exe_ = 0;
+  bool occurred{false};
+  double log_p_idle_rest{log_p_idle};
+  for (int i_event{0}; i_event < events_.size(); i_event++) {
+    auto &&event{events_[i_event]};
+    event->RecordOpportunities();
+    if (occurred) {
+      n_events_to_exe_ += event->SampleStatistics_NoDist(false);
+      continue;
+    }
+    double p_occur{-std::expm1(log_p_idle_[i_event])};
+    double p_occur_rest{-std::expm1(log_p_idle_rest)};
+    log_p_idle_rest -= log_p_idle_[i_event];
+    if (p_occur > 0.0 and SysRNG::GetRanProb(SysRNG::Kinetics) * p_occur_rest < p_occur) {
+      occurred = true;
+      n_events_to_exe_ += event->SampleStatistics_NoDist(true);
+    } else {
+      event->n_expected_ = 0;
+    }
+  }
+  n_scheduled_tot_ += n_events_to_exe_;
+  if (n_events_to_exe_ > 1) {
+    ResolveConflicts();
+  }
+  ExecuteSequence();
+  return n_idle + 1;
+}
+
+void EventManager::SetTimestep(size_t n_steps) {
+
+  for (auto &&event : events_) {
+    event->SetTimestep(n_steps);
+  }
+}
+
+double EventManager::GetMaxProbPerEntry() {
+
+  double p_max{0.0};
+  for (auto &&event : events_) {
+    p_max = std::max(p_max, event->GetMaxProbPerEntry());
+  }
+  return p_max;
+}
+
+double EventManager::GetConflictFraction() {
+
+  double frac{0.0};
+  if (n_scheduled_tot_ > 0) {
+    frac = double(n_conflicts_tot_) / n_scheduled_tot_;
+  }
+  n_scheduled_tot_ = 0;
+  n_conflicts_tot_ = 0;
+  return frac;
+}
+
+void EventManager::StartTimestep(size_t n_steps) {
+
+  t_elapsed_ = 0.0;
+  t_window_ = double(n_steps);
+  for (auto &&event : events_) {
+    event->RecordOpportunities();
+  }
+}
+
+bool EventManager::ExecuteNextEvent() {
+
+  // Sum propensities of all events; these change after every execution
+  if (events_.size() > propensities_.size()) {
+    propensities_.resize(events_.size());
+  }
+  double a_tot{0.0};
+  for (int i_event{0}; i_event < events_.size(); i_event++) {
+    propensities_[i_event] = events_[i_event]->GetPropensity();
+    a_tot += propensities_[i_event];
+  }
+  // Waiting time until next event is exponentially distributed
+  double t_next{t_window_};
+  if (a_tot > 0.0) {
+    double t_wait{SysRNG::SampleExponential(1.0 / a_tot)};
+    t_next = std::min(t_window_, t_elapsed_ + t_wait);
+  }
+  // Windows may span several steps; record each that begins before t_next
+  double t_stop{std::min(t_next, t_window_ - 1.0)};
+  size_t n_steps{size_t(t_stop) - size_t(t_elapsed_)};
+  if (n_steps > 0) {
+    for (auto &&event : events_) {
+      event->RecordOpportunities(n_steps);
+    }
+  }
+  if (t_next >= t_window_) {
+    return false;
+  }
+  t_elapsed_ = t_next;
+  // Choose which event occurs w/ probability proportional to its propensity
+  double ran{SysRNG::GetRanProb(SysRNG::Kinetics) * a_tot};
+  size_t i_picked{0};
+  for (int i_event{0}; i_event < events_.size(); i_event++) {
+    if (propensities_[i_event] == 0.0) {
+      continue;
+    }
+    // Falls back to last event w/ non-zero propensity in case of round-off
+    i_picked = i_event;
+    if (ran < propensities_[i_event]) {
+      break;
+    }
+    ran -= propensities_[i_event];
+  }
+  Sys::Log(1, "Executing event %s\n", events_[i_picked]->name_.c_str());
+  events_[i_picked]->ExecuteSingle();
+  return true;
+}
@@ -6,25 +6,108 @@ class EventManager {
 private:
   int n_events_to_exe_;
   Vec<Event *> events_to_exe_;
+  // Conflict resolution; objects are claimed by stamping w/ current sample no.
+  struct ScheduledEvent {
+    Event *event_{nullptr};
+    Object *target_{nullptr};
+    bool removed_{false};
+  };
+  size_t i_sample_{0};
+  Vec<ScheduledEvent> scheduled_;
+  Vec<size_t> claim_stamps_;  // [object ID]; i_sample_ of most recent claim
+  Vec<size_t> claim_holders_; // [object ID]; index of claimant in scheduled_
+  // Adaptive timestep; tallied since last call to GetConflictFraction()
+  size_t n_scheduled_tot_{0}; // # of events scheduled before conflict removal
+  size_t n_conflicts_tot_{0}; // # of events removed due to conflicts
+  // Multi-rate; slow events are sampled (at most) once every n steps
+  size_t n_steps_per_sample_max_{1};
+  // Continuous-time (BKL) engine; time is measured in units of timesteps
+  double t_window_{1.0};      // # of timesteps spanned by the current window
+  double t_elapsed_{0.0};     // Time elapsed since start of current window
+  Vec<double> propensities_; // [i_event]; expected # of events per timestep
+  // Idle-step skip-ahead; only used if a step is likely to have no events
+  double p_idle_min_{0.5};
+  Vec<double> log_p_idle_; // [i_event]; log of prob. of no events in a step
 
 public:
-  Vec<Event> events_;
+  bool continuous_{false}; // If true, use BKL engine instead of leaping
+  Vec<UPtr<Event>> events_;
 
 private:
   void SampleEventStatistics();
+  void ResolveConflicts();
   void GenerateExecutionSequence();
+  void ExecuteSequence();
+  void PrintStats(Str name, size_t n_executed, size_t n_opportunities) {
+    printf("p_%s = %g [%zu exe]\n", name.c_str(),
+           double(n_executed) / n_opportunities, n_executed);
+  }
 
 public:
   EventManager();
   ~EventManager() {
     for (auto &&event : events_) {
-      printf("p_%s = %g [%zu exe]\n", event.name_.c_str(),
-             double(event.n_executed_tot_) / event.n_opportunities_tot_,
-             event.n_executed_tot_);
+      if (!event->fused_) {
+        PrintStats(event->name_, event->n_executed_tot_,
+                   event->n_opportunities_tot_);
+        continue;
+      }
+      for (int i{0}; i < event->outcome_names_.size(); i++) {
+        PrintStats(event->name_ + "_" + event->outcome_names_[i],
+                   event->n_executed_outcome_[i], event->n_opportunities_tot_);
+      }
     }
   }
   void Initialize();
+  // Binomial-mode event; each available target is equally likely
+  template <typename TARGET_T, typename DIST_T, typename EXE_T>
+  void AddEvent(Str name, double p_occur, size_t *n_avail,
+                Vec<TARGET_T *> *target_pool, DIST_T prob_dist, EXE_T exe) {
+    events_.emplace_back(new EventKernel<TARGET_T, DIST_T, EXE_T>(
+        name, p_occur, n_avail, target_pool, prob_dist, exe));
+  }
+  // Binomial-mode event acting on a single bin of a multi-dim. population
+  template <typename TARGET_T, typename DIST_T, typename EXE_T>
+  void AddEvent(Str name, double p_occur, Bin<TARGET_T> *bin, DIST_T prob_dist,
+                EXE_T exe) {
+    events_.emplace_back(
+        new EventKernel<TARGET_T, DIST_T, EXE_T, Unweighted, Bin<TARGET_T>>(
+            name, p_occur, &bin->size_, bin, prob_dist, exe));
+  }
+  // Poisson-mode event; targets are weighted individually via weight_fn
+  template <typename TARGET_T, typename ENTRY_T, typename DIST_T,
+            typename WEIGHT_T, typename EXE_T>
+  void AddEvent(Str name, double p_occur, Population<ENTRY_T, TARGET_T> *pop,
+                DIST_T prob_dist, WEIGHT_T weight_fn, EXE_T exe) {
+    events_.emplace_back(new EventKernel<TARGET_T, DIST_T, EXE_T, WEIGHT_T>(
+        name, p_occur, pop, prob_dist, weight_fn, exe));
+  }
+  // Fused binomial-mode event; each target undergoes at most one outcome
+  template <typename TARGET_T, typename DIST_T, typename EXE_T>
+  void AddFusedEvent(Str name, Vec<std::pair<Str, double>> outcomes,
+                     Bin<TARGET_T> *bin, DIST_T prob_dist, EXE_T exe) {
+    events_.emplace_back(
+        new FusedEventKernel<TARGET_T, DIST_T, EXE_T, Unweighted,
+                             Bin<TARGET_T>>(name, outcomes, &bin->size_, bin,
+                                            prob_dist, exe));
+  }
+  // Fused Poisson-mode event; outcomes are weighted via weight_fn
+  template <typename TARGET_T, typename ENTRY_T, typename DIST_T,
+            typename WEIGHT_T, typename EXE_T>
+  void AddFusedEvent(Str name, Vec<std::pair<Str, double>> outcomes,
+                     Population<ENTRY_T, TARGET_T> *pop, DIST_T prob_dist,
+                     WEIGHT_T weight_fn, EXE_T exe) {
+    events_.emplace_back(
+        new FusedEventKernel<TARGET_T, DIST_T, EXE_T, WEIGHT_T>(
+            name, outcomes, pop, prob_dist, weight_fn, exe));
+  }
   void ExecuteEvents();
+  size_t ExecuteEvents_SkipAhead(size_t n_steps_max);
+  void SetTimestep(size_t n_steps);
+  double GetMaxProbPerEntry();
+  double GetConflictFraction();
+  void StartTimestep(size_t n_steps);
+  bool ExecuteNextEvent();
 };
 
 #endif
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "filament_manager.hpp"
 #include "protein_manager.hpp"
+#include <limits>
 
 void FilamentManager::SetParameters() {
 
@@ -26,6 +27,14 @@ void FilamentManager::SetParameters() {
   }
 }
 
+void FilamentManager::SetTimestep(double dt_kmc) {
+
+  dt_eff_ = dt_kmc / n_bd_iterations_;
+  for (auto &&pf : proto_) {
+    pf.SetTimestep(dt_kmc);
+  }
+}
+
 void FilamentManager::GenerateFilaments() {
 
   using namespace Sys;
@@ -91,6 +100,54 @@ bool FilamentManager::AllFilamentsImmobile() {
   return true;
 }
 
+size_t FilamentManager::GetNumStepsImmobile() {
+
+  // # of steps (from now) for which no BD will occur
+  size_t n_steps{std::numeric_limits<size_t>::max()};
+  if (!mobile_) {
+    return n_steps;
+  }
+  for (auto const &pf : proto_) {
+    if (Sys::i_step_ >= pf.immobile_until_) {
+      return 0;
+    }
+    n_steps = std::min(n_steps, pf.immobile_until_ - Sys::i_step_);
+  }
+  return n_steps;
+}
+
+bool FilamentManager::CheckDisplacement() {
+
+  if (!mobile_) {
+    return false;
+  }
+  // Filaments are rigid, so no site can be displaced further than either end
+  bool displaced{pos_ends_ref_.empty()};
+  for (int i_pf{0}; i_pf < proto_.size() and !displaced; i_pf++) {
+    BindingSite *ends[2]{proto_[i_pf].plus_end_, proto_[i_pf].minus_end_};
+    for (int i_end{0}; i_end < 2; i_end++) {
+      Vec2 pos{ends[i_end]->GetPosition()};
+      double dr_sq{0.0};
+      for (int i_dim{0}; i_dim < _n_dims_max; i_dim++) {
+        double pos_ref{pos_ends_ref_[2 * i_pf + i_end][i_dim]};
+        dr_sq += Square(pos[i_dim] - pos_ref);
+      }
+      if (dr_sq > Square(r_tol_)) {
+        displaced = true;
+      }
+    }
+  }
+  if (!displaced) {
+    return false;
+  }
+  pos_ends_ref_.resize(2 * proto_.size());
+  for (int i_pf{0}; i_pf < proto_.size(); i_pf++) {
+    pos_ends_ref_[2 * i_pf] = proto_[i_pf].plus_end_->GetPosition();
+    pos_ends_ref_[2 * i_pf + 1] = proto_[i_pf].minus_end_->GetPosition();
+  }
+  return true;
+}
+
 void FilamentManager::UpdateForces() {
   for (auto &&pf : proto_) {
     for (int i_dim{0}; i_dim < _n_dims_max; i_dim++) {
@@ -114,4 +171,71 @@ void FilamentManager::UpdateForces() {
   proteins_->UpdateExtensions();
 }
 
-void FilamentManager::UpdateLattice() { proteins_->UpdateLatticeDeformation(); }
\ No newline at end of file
+void FilamentManager::UpdateLattice() { proteins_->UpdateLatticeDeformation(); }
+
+void FilamentManager::ResetLattice() {
+
+  for (auto &&pf : proto_) {
+    pf.store_.ClearDeformation();
+  }
+  proteins_->ResetLatticeDeformation();
+}
+
+void FilamentManager::UpdateSite(BindingSite *site) {
+
+  for (auto &&pop : unoccupied_) {
+    pop.second.Update(site);
+  }
+  if (Sys::test_ == Sys::TestMode::MotorLatticeStep) {
+    return;
+  }
+  int n_neighbs{site->GetNumNeighborsOccupied()};
+  site->SetWeight_Bind(weight_neighbs_bind_[n_neighbs]);
+  site->SetWeight_Unbind(weight_neighbs_unbind_[n_neighbs]);
+}
+
+void FilamentManager::UpdateUnoccupied() {
+
+  // Weights of bound proteins (e.g., spring extensions) depend on position
+  if (CheckDisplacement()) {
+    proteins_->FlagWeightsForUpdate();
+  }
+  // Full update of every site; only needed on startup or if explicitly flagged
+  if (!up_to_date_) {
+    up_to_date_ = true;
+    for (auto &&pop : unoccupied_) {
+      pop.second.ZeroOut();
+    }
+    for (auto &&site : sites_) {
+      UpdateSite(site);
+    }
+    if (Sys::test_ != Sys::TestMode::MotorLatticeStep) {
+      ResetLattice();
+    }
+    proteins_->FlagWeightsForUpdate();
+    return;
+  }
+  // Otherwise, only update sites whose occupancy or n_neighbs has changed
+  bool lattice_changed{false};
+  for (auto &&pf : proto_) {
+    for (auto const &site : pf.modified_sites_) {
+      lattice_changed = true;
+      UpdateSite(site);
+      for (auto const &neighb : site->GetNeighbors()) {
+        UpdateSite(neighb);
+      }
+    }
+  }
+  if (!lattice_changed or !proteins_->motors_.lattice_coop_active_) {
+    return;
+  }
+  if (Sys::test_ == Sys::TestMode::MotorLatticeStep) {
+    return;
+  }
+  // Only motors that moved update the lattice, but that can be far-reaching
+  UpdateLattice();
+  for (auto &&pop : unoccupied_) {
+    pop.second.FlagWeightsForUpdate();
+  }
+  proteins_->FlagWeightsForUpdate();
+}
\ No newline at end of file
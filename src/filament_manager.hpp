@@ -22,6 +22,10 @@ private:
   size_t n_bd_iterations_{0};
   double dt_eff_{0.0};
 
+  // Protein weights are only refreshed once a site is displaced beyond r_tol_
+  double r_tol_{0.01};        // nm
+  Vec<Vec2> pos_ends_ref_; // [2 * i_pf + i_end][i_dim]; at last refresh
+
   ProteinManager *proteins_{nullptr};
 
 public:
@@ -29,16 +33,19 @@ public:
   Vec<Protofilament> proto_;
   Vec<BindingSite *> sites_;
 
-  Map<Str, Population<Object>> unoccupied_;
+  Map<Str, Population<BindingSite>> unoccupied_;
 
 private:
   void SetParameters();
   void GenerateFilaments();
 
   bool AllFilamentsImmobile();
+  bool CheckDisplacement();
 
   void UpdateForces();
   void UpdateLattice();
+  void ResetLattice();
+  void UpdateSite(BindingSite *site);
 
 public:
   FilamentManager() {}
@@ -47,47 +54,20 @@ public:
     SetParameters();
     GenerateFilaments();
   }
-  void AddPop(Str name, Fn<Vec<Object *>(Object *)> sort) {
-    unoccupied_.emplace(name, Population<Object>(name, sort, sites_.size()));
+  void AddPop(Str name,
+              Fn<void(BindingSite *, MemberList<BindingSite> &)> sort) {
+    unoccupied_.emplace(name,
+                        Population<BindingSite>(name, sort, sites_.size()));
   }
-  void AddPop(Str name, Fn<Vec<Object *>(Object *)> sort, Vec<size_t> i_size,
-              Vec<int> i_min, Fn<Vec<int>(Object *)> get_i) {
+  void AddPop(Str name, Fn<void(BindingSite *, MemberList<BindingSite> &)> sort,
+              Vec<size_t> i_size, Fn<void(BindingSite *, BinIndices &)> get_i) {
     Vec<size_t> sz{i_size[0], i_size[1], i_size[2], sites_.size()};
-    unoccupied_.emplace(name, Population<Object>(name, sort, sz, i_min, get_i));
+    unoccupied_.emplace(name, Population<BindingSite>(name, sort, sz, get_i));
   }
   void FlagForUpdate() { up_to_date_ = false; }
-  void UpdateUnoccupied() {
-    if (up_to_date_) {
-      return;
-    }
-    up_to_date_ = true;
-    for (auto &&pop : unoccupied_) {
-      pop.second.ZeroOut();
-    }
-    // Add sites to unoccupied_ and update weights
-    for (auto &&site : sites_) {
-      for (auto &&pop : unoccupied_) {
-        pop.second.Sort(site);
-      }
-      int n_neighbs{site->GetNumNeighborsOccupied()};
-      if (Sys::test_mode_.empty()) {
-        site->SetWeight_Bind(weight_neighbs_bind_[n_neighbs]);
-        site->SetWeight_Unbind(weight_neighbs_unbind_[n_neighbs]);
-        continue;
-      }
-      if (Sys::test_mode_ != "motor_lattice_step") {
-        site->SetWeight_Bind(weight_neighbs_bind_[n_neighbs]);
-        site->SetWeight_Unbind(weight_neighbs_unbind_[n_neighbs]);
-      }
-    }
-    if (Sys::test_mode_.empty()) {
-      UpdateLattice();
-      return;
-    }
-    if (Sys::test_mode_ != "motor_lattice_step") {
-      UpdateLattice();
-    }
-  }
+  void SetTimestep(double dt_kmc);
+  size_t GetNumStepsImmobile();
+  void UpdateUnoccupied();
   void RunBD() {
     if (AllFilamentsImmobile()) {
       return;
@@ -5,8 +5,6 @@
 #include "system_parameters.hpp"
 #include "system_rng.hpp"
 
-class BindingSite;
-
 class LinearSpring : public Object {
 private:
   double k_slack_{0.0};  // For when r < r_0; pN/nm
@@ -15,7 +13,7 @@ private:
 
   double dr_{0.0};
   Vec<double> torque_;
-  Vec2D<double> f_vec_; // Vector of force for each endpoint (points to center)
+  Vec<Vec2> f_vec_; // Vector of force for each endpoint (points to center)
 
   Vec<Object *> endpoints_;
 
@@ -43,7 +41,7 @@ private:
   }
   void ForceUnbind() {
     // FIXME need to incorporate influence from other springs, e.g. tethers
-    if (SysRNG::GetRanProb() < 0.5) {
+    if (SysRNG::GetRanProb(SysRNG::Proteins) < 0.5) {
       endpoints_[0]->Unbind();
     } else {
       endpoints_[1]->Unbind();
@@ -67,13 +65,12 @@ public:
     SetCutoffs();
     torque_.push_back(0.0);
     torque_.push_back(0.0);
-    Vec<double> zeroes(_n_dims_max, 0.0);
-    f_vec_.push_back(zeroes);
-    f_vec_.push_back(zeroes);
+    f_vec_.push_back({});
+    f_vec_.push_back({});
   }
   bool UpdatePosition() {
     double r_sq{0.0};                    // Square of spring length
-    Vec<double> r_hat(_n_dims_max, 0.0); // points from 2nd to 1st endpoint
+    Vec2 r_hat{};                        // points from 2nd to 1st endpoint
     for (int i_dim{0}; i_dim < _n_dims_max; i_dim++) {
       r_hat[i_dim] = endpoints_[0]->pos_[i_dim] - endpoints_[1]->pos_[i_dim];
       r_sq += Square(r_hat[i_dim]);
@@ -91,8 +88,8 @@ public:
     // printf("r_hat: [%g, %g]\n", r_hat[0], r_hat[1]);
     // Get theta
     /*
-    Vec2D<double> u{endpoints_[0]->GetBoundObjectOrientation(),
-                    endpoints_[1]->GetBoundObjectOrientation()};
+    Mat2 u{endpoints_[0]->GetBoundObjectOrientation(),
+           endpoints_[1]->GetBoundObjectOrientation()};
     Vec<double> theta{M_PI - acos(Dot(r_hat, u[0])), acos(Dot(r_hat, u[1]))};
     // printf("u = [%g, %g] & [%g, %g]\n", u[0][0], u[0][1], u[1][0], u[1][1]);
     // printf("theta = %g & %g\n", theta[0], theta[1]);
@@ -145,12 +142,11 @@ public:
                             : 0.5 * k_slack_ * Square(dr_)};
     return exp(_lambda_spring * energy / Params::kbT);
   }
-  double GetWeight_Shift(Object *static_site, Object *old_site,
-                         Object *new_site) {
+  double GetWeight_Shift(Vec2 const &static_pos, Vec2 const &new_pos) {
     double energy_old{dr_ > 0.0 ? 0.5 * k_spring_ * Square(dr_)
                                 : 0.5 * k_slack_ * Square(dr_)};
-    double r_x_new{new_site->pos_[0] - static_site->pos_[0]};
-    double r_y_new{new_site->pos_[1] - static_site->pos_[1]};
+    double r_x_new{new_pos[0] - static_pos[0]};
+    double r_y_new{new_pos[1] - static_pos[1]};
     double r_new{sqrt(Square(r_x_new) + Square(r_y_new))};
     if (r_new < r_min_ or r_new > r_max_) {
       return 0.0;
@@ -13,7 +13,7 @@ void Motor::ChangeConformation() {
   //   printf("site %i\n", site->index_);
   if (site == site->filament_->plus_end_ and
       Params::Motors::endpausing_active) {
-    if (Sys::test_mode_.empty() or site->filament_->index_ == 0) {
+    if (Sys::test_ == Sys::TestMode::None or site->filament_->index_ == 0) {
       return;
     }
   }
@@ -33,10 +33,7 @@ BindingSite *Motor::GetDockSite() {
   int dir{active_head->trailing_ ? 1 : -1};
   int i_dock{(int)site->index_ + dir * site->filament_->dx_};
   if (i_dock < 0 or i_dock > site->filament_->sites_.size() - 1) {
-    if (Sys::test_mode_.empty()) {
-      return nullptr;
-    }
-    if (Sys::test_mode_ != "filament_ablation") {
+    if (Sys::test_ != Sys::TestMode::FilamentAblation) {
       return nullptr;
     }
     if (Sys::i_step_ > Sys::ablation_step_) {
@@ -66,75 +63,75 @@ CatalyticHead *Motor::GetDockedHead() {
   return nullptr;
 }
 
-void Motor::ApplyLatticeDeformation() {
+BindingSite *Motor::GetEpicenter() {
 
   if (n_heads_active_ == 0) {
-    return;
+    return nullptr;
   }
   //   printf("hi\n");
-  BindingSite *epicenter{nullptr};
   if (n_heads_active_ == 1) {
-    epicenter = GetActiveHead()->site_;
+    return GetActiveHead()->site_;
   } else if (head_one_.trailing_) {
-    epicenter = head_one_.site_;
+    return head_one_.site_;
   } else {
-    epicenter = head_two_.site_;
+    return head_two_.site_;
+  }
+}
+
+void Motor::UpdateLatticeDeformation() {
+
+  // Deformation only depends on epicenter; shift it by removing the old one
+  BindingSite *epicenter{GetEpicenter()};
+  if (epicenter == epicenter_) {
+    return;
+  }
+  if (epicenter_ != nullptr) {
+    ApplyLatticeDeformation(epicenter_, -1);
+  }
+  if (epicenter != nullptr) {
+    ApplyLatticeDeformation(epicenter, 1);
   }
+  epicenter_ = epicenter;
+}
+
+void Motor::ApplyLatticeDeformation(BindingSite *epicenter, int sign) {
+
   int i_epicenter{(int)epicenter->index_};
+  Protofilament *mt{epicenter->filament_};
+  int mt_length{(int)mt->sites_.size() - 1};
+  // Sites on the same filament are deformed in one contiguous sweep
+  int cutoff{(int)Sys::lattice_cutoff_};
+  int i_first{std::max(0, i_epicenter - cutoff)};
+  int i_last{std::min(mt_length, i_epicenter + cutoff)};
+  for (int i_scan{i_first}; i_scan <= i_last; i_scan++) {
+    int delta{std::abs(i_scan - i_epicenter)};
+    if (delta == 0) {
+      continue;
+    }
+    mt->store_.AddDeformation(i_scan, Sys::energy_lattice_[delta], sign);
+  }
+  if (Sys::test_ != Sys::TestMode::FilamentAblation or
+      Sys::i_step_ >= Sys::ablation_step_) {
+    return;
+  }
+  // Before ablation, deformations carry over onto the adjoining filament
+  Protofilament *other_mt{mt->neighbor_};
   for (int delta{1}; delta <= Sys::lattice_cutoff_; delta++) {
-    for (int dir{-1}; dir <= 1; dir += 2) {
-      int i_scan{i_epicenter + dir * delta};
-      int mt_length{(int)epicenter->filament_->sites_.size() - 1};
-      if (i_scan < 0 or i_scan > mt_length) {
-        if (Sys::test_mode_.empty()) {
-          continue;
-        }
-        if (Sys::test_mode_ != "filament_ablation" or
-            Sys::i_step_ >= Sys::ablation_step_) {
-          continue;
-        }
-        if (epicenter->filament_->index_ == 0 and i_scan > mt_length) {
-          int i_adj{i_scan - mt_length};
-          // printf("i_adj = %i\n", i_adj);
-          auto other_mt{epicenter->filament_->neighbor_};
-          if (i_adj > other_mt->sites_.size() - 1) {
-            continue;
-          }
-          BindingSite *site{&other_mt->sites_[i_adj]};
-          if (site == nullptr) {
-            printf("NO\n");
-            exit(1);
-          }
-          site->AddWeight_Bind(Sys::weight_lattice_bind_[delta]);
-          // printf("nop\n");
-          site->AddWeight_Unbind(Sys::weight_lattice_unbind_[delta]);
-          // printf("yop\n");
-          continue;
-        }
-        if (epicenter->filament_->index_ == 1 and i_scan < 0) {
-          auto other_mt{epicenter->filament_->neighbor_};
-          int i_adj{(int)other_mt->sites_.size() + i_scan};
-          // printf("i_adj = %i\n", i_adj);
-          if (i_adj < 0) {
-            continue;
-          }
-          BindingSite *site{&other_mt->sites_[i_adj]};
-          if (site == nullptr) {
-            printf("NO\n");
-            exit(1);
-          }
-          site->AddWeight_Bind(Sys::weight_lattice_bind_[delta]);
-          // printf("yop\n");
-          site->AddWeight_Unbind(Sys::weight_lattice_unbind_[delta]);
-          // printf("nop\n");
-          continue;
-        }
+    if (mt->index_ == 0 and i_epicenter + delta > mt_length) {
+      int i_adj{i_epicenter + delta - mt_length};
+      if (i_adj > other_mt->sites_.size() - 1) {
+        continue;
       }
-      if (i_scan >= 0 and i_scan < epicenter->filament_->sites_.size()) {
-        BindingSite *site{&epicenter->filament_->sites_[i_scan]};
-        site->AddWeight_Bind(Sys::weight_lattice_bind_[delta]);
-        site->AddWeight_Unbind(Sys::weight_lattice_unbind_[delta]);
+      other_mt->store_.AddDeformation(i_adj, Sys::energy_lattice_[delta],
+                                      sign);
+    }
+    if (mt->index_ == 1 and i_epicenter - delta < 0) {
+      int i_adj{(int)other_mt->sites_.size() + i_epicenter - delta};
+      if (i_adj < 0) {
+        continue;
       }
+      other_mt->store_.AddDeformation(i_adj, Sys::energy_lattice_[delta],
+                                      sign);
     }
   }
 }
@@ -215,8 +212,8 @@ bool Motor::Diffuse(CatalyticHead *head, int dir) {
   if (new_site->occupant_ != nullptr) {
     return false;
   }
-  old_site->occupant_ = nullptr;
-  new_site->occupant_ = head;
+  old_site->RemoveOccupant();
+  new_site->SetOccupant(head);
   head->site_ = new_site;
   // printf("frfr\n\n");
   return true;
@@ -228,7 +225,7 @@ bool Motor::Bind(BindingSite *site, CatalyticHead *head) {
   if (site->occupant_ != nullptr) {
     return false;
   }
-  site->occupant_ = head;
+  site->SetOccupant(head);
   head->site_ = site;
   head->ligand_ = CatalyticHead::Ligand::NONE;
   // If we bound from bulk solution, initialize head direction
@@ -237,10 +234,7 @@ bool Motor::Bind(BindingSite *site, CatalyticHead *head) {
     head->GetOtherHead()->trailing_ = true;
   }
   n_heads_active_++;
-  if (Sys::test_mode_.empty()) {
-    return true;
-  }
-  if (Sys::test_mode_ == "kinesin_mutant") {
+  if (Sys::test_ == Sys::TestMode::KinesinMutant) {
     if (head == &head_two_) {
       head->ligand_ = CatalyticHead::Ligand::ADPP;
     }
@@ -277,7 +271,7 @@ bool Motor::Hydrolyze(CatalyticHead *head) {
 bool Motor::Unbind(CatalyticHead *head) {
 
   BindingSite *site{head->site_};
-  site->occupant_ = nullptr;
+  site->RemoveOccupant();
   head->site_ = nullptr;
   head->ligand_ = CatalyticHead::Ligand::ADP;
   // If we are about to completely unbind, record this motor run
@@ -287,10 +281,7 @@ bool Motor::Unbind(CatalyticHead *head) {
     }
   }
   n_heads_active_--;
-  if (Sys::test_mode_.empty()) {
-    return true;
-  }
-  if (Sys::test_mode_ == "kinesin_mutant") {
+  if (Sys::test_ == Sys::TestMode::KinesinMutant) {
     if (n_heads_active_ == 1 and head == &head_one_) {
       //   printf("bang\n");
       //   printf("head_")
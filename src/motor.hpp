@@ -6,15 +6,19 @@
 
 class BindingSite;
 
-class Motor : public Protein {
+class Motor final : public Protein {
 protected:
   Str ligands_{"yuhh yuh"};
+  BindingSite *epicenter_{nullptr}; // Where lattice deformation is applied
 
 public:
   CatalyticHead head_one_, head_two_;
   LinearSpring tether_;
 
 private:
+  BindingSite *GetEpicenter();
+  void ApplyLatticeDeformation(BindingSite *epicenter, int sign);
+
 public:
   Motor() {}
   void Initialize(size_t sid, size_t id) {
@@ -42,7 +46,8 @@ public:
 
   bool UpdateExtension() { return false; }
 
-  void ApplyLatticeDeformation();
+  void ClearLatticeDeformation() { epicenter_ = nullptr; }
+  void UpdateLatticeDeformation();
 
   double GetWeight_Diffuse(CatalyticHead *head, int dir);
   double GetWeight_Bind_II();
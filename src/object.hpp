@@ -9,7 +9,7 @@ private:
 
 public:
   bool visible_{true};
-  Vec<double> pos_; // C.O.M. position in lab frame
+  Vec2 pos_{}; // C.O.M. position in lab frame
 
 public:
   Object() {}
@@ -17,14 +17,13 @@ public:
   void Initialize(size_t sid, size_t id) {
     unique_id_ = id;
     species_id_ = sid;
-    pos_.resize(_n_dims_max);
   }
   size_t GetID() { return unique_id_; }
   size_t GetSpeciesID() { return species_id_; }
 
   virtual bool IsOccupied() { return true; }
 
-  virtual void AddForce(Vec<double> f) {}
+  virtual void AddForce(Vec2 const &f) {}
   virtual void AddTorque(double tq) {}
 
   virtual int GetNumNeighborsOccupied() { return -1; }
@@ -35,8 +34,8 @@ public:
   virtual Object *GetHeadOne() { return nullptr; }
   virtual Object *GetHeadTwo() { return nullptr; }
 
-  virtual Vec<double> GetSpringOrientation() { return {}; }
-  virtual Vec<double> GetBoundObjectOrientation() { return {}; }
+  virtual Vec2 GetSpringOrientation() { return {}; }
+  virtual Vec2 GetBoundObjectOrientation() { return {}; }
   virtual bool Unbind() { return false; };
 };
 #endif
@@ -0,0 +1,70 @@
+#ifndef _CYLAKS_PHILOX_HPP_
+#define _CYLAKS_PHILOX_HPP_
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Philox4x32-10 counter-based generator (Salmon et al., SC '11). Each block of
+// output is a pure function of (key, stream, counter), so independent streams
+// can be derived from a single seed and no stream depends on another's usage
+class Philox {
+public:
+  using Block = std::array<uint32_t, 4>;
+  using Key = std::array<uint32_t, 2>;
+
+private:
+  Key key_{0, 0};
+  uint32_t stream_{0};
+  uint64_t i_block_{0}; // Counter; # of blocks generated thus far
+  Block block_{0, 0, 0, 0};
+  int i_word_{4}; // Next unused word of block_
+
+private:
+  static void MulHiLo(uint32_t a, uint32_t b, uint32_t &hi, uint32_t &lo) {
+    uint64_t product{uint64_t(a) * b};
+    hi = uint32_t(product >> 32);
+    lo = uint32_t(product);
+  }
+
+public:
+  Philox() {}
+  static Block Generate(uint64_t i_block, uint32_t stream, Key key) {
+    Block ctr{uint32_t(i_block), uint32_t(i_block >> 32), stream, 0};
+    for (int i_round{0}; i_round < 10; i_round++) {
+      uint32_t hi0, lo0, hi1, lo1;
+      MulHiLo(0xD2511F53, ctr[0], hi0, lo0);
+      MulHiLo(0xCD9E8D57, ctr[2], hi1, lo1);
+      ctr = {hi1 ^ ctr[1] ^ key[0], lo1, hi0 ^ ctr[3] ^ key[1], lo0};
+      key[0] += 0x9E3779B9;
+      key[1] += 0xBB67AE85;
+    }
+    return ctr;
+  }
+  void Seed(uint64_t seed, uint32_t stream) {
+    key_ = {uint32_t(seed), uint32_t(seed >> 32)};
+    stream_ = stream;
+    i_block_ = 0;
+    i_word_ = 4;
+  }
+  uint32_t GetUInt() {
+    if (i_word_ == 4) {
+      block_ = Generate(i_block_++, stream_, key_);
+      i_word_ = 0;
+    }
+    return block_[i_word_++];
+  }
+  // Uniform on [0, 1) w/ 32 bits of resolution
+  double GetUniform() { return GetUInt() * 0x1p-32; }
+  // Bulk generation; starts from a fresh block so that each iteration is
+  // independent of the others and can be vectorized
+  void FillUniform(double *ran, size_t n) {
+    i_word_ = 4;
+    for (size_t i_ran{0}; i_ran < n; i_ran += 4) {
+      Block block{Generate(i_block_++, stream_, key_)};
+      for (size_t i_word{0}; i_word < 4 and i_ran + i_word < n; i_word++) {
+        ran[i_ran + i_word] = block[i_word] * 0x1p-32;
+      }
+    }
+  }
+};
+#endif
@@ -3,84 +3,218 @@
 #include "definitions.hpp"
 #include "system_namespace.hpp"
 
-template <typename ENTRY_T> struct Population {
+// Weighted (1-D) populations record which slots need their weight updated
+struct WeightFlags {
+  bool weighted_{false};
+  bool all_flagged_{true};
+  Vec<bool> slot_flagged_;
+  Vec<size_t> flagged_slots_;
+  void FlagSlotForUpdate(size_t i_slot) {
+    if (!weighted_ or slot_flagged_[i_slot]) {
+      return;
+    }
+    slot_flagged_[i_slot] = true;
+    flagged_slots_.push_back(i_slot);
+  }
+  void FlagWeightsForUpdate() { all_flagged_ = true; }
+  void ClearFlaggedWeights() {
+    for (auto const &i_slot : flagged_slots_) {
+      slot_flagged_[i_slot] = false;
+    }
+    flagged_slots_.clear();
+    all_flagged_ = false;
+  }
+};
+
+// Storage that sort callbacks write into; an entry has at most 2 members
+// (e.g., heads), and multi-dim. populations have at most 3 bin indices
+template <typename MEMBER_T> using MemberList = FixedVec<MEMBER_T *, 2>;
+using BinIndices = FixedVec<int, 3>;
+
+// Contiguous run of a multi-dim. population's members that share bin indices;
+// its address is stable, but entries_ moves as neighboring bins change size
+template <typename MEMBER_T> struct Bin {
+  size_t size_{0};
+  MEMBER_T **entries_{nullptr};
+  MEMBER_T *operator[](size_t i) const { return entries_[i]; }
+};
+
+// Sorts entries (e.g., proteins) into lists of members (e.g., their heads)
+template <typename ENTRY_T, typename MEMBER_T = ENTRY_T>
+struct Population : public WeightFlags {
 private:
   bool one_d_{true};
   // 1-d stuff
-  Fn<Vec<ENTRY_T *>(ENTRY_T *)> get_members_;
-  // multi-dim stuff
-  Vec<int> min_indices_;
-  Fn<Vec<int>(ENTRY_T *)> get_bin_indices_;
+  Fn<void(ENTRY_T *, MemberList<MEMBER_T> &)> get_members_;
+  // multi-dim stuff; bins are stored back-to-back in order of flat index
+  Vec<size_t> dim_size_;     // [i_dim]; # of bins along each dimension
+  Vec<size_t> bin_offsets_;  // [i_bin]; index of first member in bin_store_
+  Vec<MEMBER_T *> bin_store_; // Members of every bin; sized to # of entries
+  Fn<void(MEMBER_T *, BinIndices &)> get_bin_indices_;
+  // Bookkeeping that allows entries to be sorted in place via Update()
+  struct Location {
+    size_t i_bin_{0};
+    size_t index_{0}; // Index within entries_ (1-D) or bin_store_ (multi-dim)
+  };
+  UMap<ENTRY_T *, MemberList<MEMBER_T>> members_; // Sorted members of entry
+  UMap<MEMBER_T *, Location> locations_;          // Where each is stored
 
-  void AddEntry(ENTRY_T *entry) { entries_[size_++] = entry; }
-  void AddEntry(ENTRY_T *entry, Vec<int> indices) {
-    int k{indices[0]};
-    int j{indices.size() > 1 ? indices[1] : 0};
-    int i{indices.size() > 2 ? indices[2] : 0};
-    Sys::Log(2, "entry added w/ ijk = %i%i%i\n", i, j, k);
-    bin_entries_[i][j][k][bin_size_[i][j][k]++] = entry;
-    if (entry->GetNumHeadsActive() == 2) {
-      bin_entries_[i][j][k][bin_size_[i][j][k]++] = entry->GetOtherHead();
+  size_t GetBinIndex(BinIndices const &indices) {
+    size_t k{size_t(indices[0])};
+    size_t j{indices.size() > 1 ? size_t(indices[1]) : 0};
+    size_t i{indices.size() > 2 ? size_t(indices[2]) : 0};
+    Sys::Log(2, "entry added w/ ijk = %zu%zu%zu\n", i, j, k);
+    return (i * dim_size_[1] + j) * dim_size_[2] + k;
+  }
+  void SetBinOffset(size_t i_bin, size_t offset) {
+    bin_offsets_[i_bin] = offset;
+    bins_[i_bin].entries_ = bin_store_.data() + offset;
+  }
+  void MoveWithinStore(size_t i_from, size_t i_to) {
+    MEMBER_T *member{bin_store_[i_from]};
+    bin_store_[i_to] = member;
+    locations_.at(member).index_ = i_to;
+  }
+  Location AddEntry(MEMBER_T *entry) {
+    entries_[size_] = entry;
+    FlagSlotForUpdate(size_);
+    return {0, size_++};
+  }
+  Location AddEntry(MEMBER_T *entry, BinIndices const &indices) {
+    size_t i_bin{GetBinIndex(indices)};
+    if (bin_offsets_.back() + bins_.back().size_ == bin_store_.size()) {
+      Sys::ErrorExit("Population::AddEntry()");
+    }
+    // Open a slot at the end of this bin by shifting each later bin up by one;
+    // only its first member needs to move (to the bin's end)
+    for (size_t i_later{bins_.size() - 1}; i_later > i_bin; i_later--) {
+      size_t i_first{bin_offsets_[i_later]};
+      if (bins_[i_later].size_ > 0) {
+        MoveWithinStore(i_first, i_first + bins_[i_later].size_);
+      }
+      SetBinOffset(i_later, i_first + 1);
+    }
+    size_t i_slot{bin_offsets_[i_bin] + bins_[i_bin].size_++};
+    bin_store_[i_slot] = entry;
+    Sys::Log(2, "bin size = %zu\n", bins_[i_bin].size_);
+    return {i_bin, i_slot};
+  }
+  void Track(MEMBER_T *member, Location loc, MemberList<MEMBER_T> &record) {
+    locations_[member] = loc;
+    record.push_back(member);
+  }
+  void RemoveMember(MEMBER_T *member) {
+    auto itr{locations_.find(member)};
+    if (itr == locations_.end()) {
+      return;
+    }
+    Location loc{itr->second};
+    locations_.erase(itr);
+    if (one_d_) {
+      // Swap last entry into the vacated slot
+      size_t i_last{--size_};
+      if (loc.index_ == i_last) {
+        return;
+      }
+      MEMBER_T *moved{entries_[i_last]};
+      entries_[loc.index_] = moved;
+      locations_.at(moved).index_ = loc.index_;
+      FlagSlotForUpdate(loc.index_);
+      return;
+    }
+    // Swap last entry of this bin into the vacated slot, then close the gap
+    // left at its end by shifting each later bin down by one
+    size_t i_last{bin_offsets_[loc.i_bin_] + --bins_[loc.i_bin_].size_};
+    if (loc.index_ != i_last) {
+      MoveWithinStore(i_last, loc.index_);
+    }
+    for (size_t i_later{loc.i_bin_ + 1}; i_later < bins_.size(); i_later++) {
+      size_t i_first{bin_offsets_[i_later]};
+      if (bins_[i_later].size_ > 0) {
+        MoveWithinStore(i_first + bins_[i_later].size_ - 1, i_first - 1);
+      }
+      SetBinOffset(i_later, i_first - 1);
     }
-    Sys::Log(2, "bin size = %i\n", bin_size_[i][j][k]);
   }
 
 public:
   Str name_;
   size_t size_{0};
-  Vec<ENTRY_T *> entries_;
-  Vec3D<size_t> bin_size_;       // [n_neighbs][x_dub][x]
-  Vec4D<ENTRY_T *> bin_entries_; // [n_neighbs][x_dub][x][i]
+  Vec<MEMBER_T *> entries_;
+  Vec<Bin<MEMBER_T>> bins_; // [i_bin]; see GetBin()
   Population() {}
-  Population(Str name, Fn<Vec<ENTRY_T *>(ENTRY_T *)> getmems, size_t size_ceil)
+  Population(Str name, Fn<void(ENTRY_T *, MemberList<MEMBER_T> &)> getmems,
+             size_t size_ceil)
       : name_{name}, get_members_{getmems} {
     entries_.resize(size_ceil);
   }
-  Population(Str name, Fn<Vec<ENTRY_T *>(ENTRY_T *)> getmems,
-             Vec<size_t> size_ceil, Vec<int> i_min,
-             Fn<Vec<int>(ENTRY_T *)> getindices)
-      : name_{name}, get_members_{getmems}, min_indices_{i_min},
-        get_bin_indices_{getindices}, one_d_{false} {
+  Population(Str name, Fn<void(ENTRY_T *, MemberList<MEMBER_T> &)> getmems,
+             Vec<size_t> size_ceil,
+             Fn<void(MEMBER_T *, BinIndices &)> getindices)
+      : name_{name}, get_members_{getmems}, get_bin_indices_{getindices},
+        one_d_{false} {
     assert(size_ceil.size() == 4);
-    assert(min_indices_.size() == 3);
-    bin_size_.resize(size_ceil[0]);
-    bin_entries_.resize(size_ceil[0]);
-    for (int i{0}; i < bin_entries_.size(); i++) {
-      bin_size_[i].resize(size_ceil[1]);
-      bin_entries_[i].resize(size_ceil[1]);
-      for (int j{0}; j < bin_entries_[i].size(); j++) {
-        bin_size_[i][j].resize(size_ceil[2]);
-        bin_entries_[i][j].resize(size_ceil[2]);
-        for (int k{0}; k < bin_entries_[i][j].size(); k++) {
-          bin_size_[i][j][k] = 0;
-          bin_entries_[i][j][k].resize(size_ceil[3]);
-        }
-      }
+    dim_size_ = {size_ceil[0], size_ceil[1], size_ceil[2]};
+    bins_.resize(size_ceil[0] * size_ceil[1] * size_ceil[2]);
+    bin_offsets_.resize(bins_.size());
+    bin_store_.resize(size_ceil[3]);
+    for (size_t i_bin{0}; i_bin < bins_.size(); i_bin++) {
+      SetBinOffset(i_bin, 0);
+    }
+  }
+  // i, j, & k correspond to bin indices [2], [1], & [0], respectively
+  Bin<MEMBER_T> *GetBin(size_t i, size_t j, size_t k) {
+    return &bins_[(i * dim_size_[1] + j) * dim_size_[2] + k];
+  }
+  void EnableWeights() {
+    if (!one_d_ or weighted_) {
+      Sys::ErrorExit("Population::EnableWeights()");
     }
+    weighted_ = true;
+    slot_flagged_.resize(entries_.size());
   }
   void ZeroOut() {
+    FlagWeightsForUpdate();
+    members_.clear();
+    locations_.clear();
     if (one_d_) {
       size_ = 0;
     } else {
-      for (int i{min_indices_[0]}; i < bin_size_.size(); i++) {
-        for (int j{min_indices_[1]}; j < bin_size_[i].size(); j++) {
-          for (int k{min_indices_[2]}; k < bin_size_[i][j].size(); k++) {
-            bin_size_[i][j][k] = 0;
-          }
-        }
+      for (size_t i_bin{0}; i_bin < bins_.size(); i_bin++) {
+        bins_[i_bin].size_ = 0;
+        SetBinOffset(i_bin, 0);
       }
     }
   }
-  void Sort(ENTRY_T *entry) {
-    Vec<ENTRY_T *> members{get_members_(entry)};
-    // printf("%i MEMBERS\n", members.size());
+  // Removes any members that entry previously sorted into this population
+  void Remove(ENTRY_T *entry) {
+    auto itr{members_.find(entry)};
+    if (itr == members_.end()) {
+      return;
+    }
+    for (auto const &member : itr->second) {
+      RemoveMember(member);
+    }
+    itr->second.clear();
+  }
+  // (Re-)sorts a single entry in place, e.g., after it changes state
+  void Update(ENTRY_T *entry) {
+    Remove(entry);
+    MemberList<MEMBER_T> members;
+    get_members_(entry, members);
+    if (members.empty()) {
+      return;
+    }
+    MemberList<MEMBER_T> &record{members_[entry]};
     for (auto const &member : members) {
       if (one_d_) {
-        AddEntry(member);
+        Track(member, AddEntry(member), record);
       } else {
-        AddEntry(member, get_bin_indices_(member));
+        BinIndices indices;
+        get_bin_indices_(member, indices);
+        Track(member, AddEntry(member, indices), record);
       }
     }
   }
 };
-#endif
\ No newline at end of file
+#endif
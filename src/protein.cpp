@@ -12,10 +12,8 @@ bool Protein::UpdateExtension() {
     return true;
   }
   // Update head positions
-  for (int i_dim{0}; i_dim < _n_dims_max; i_dim++) {
-    head_one_.pos_[i_dim] = head_one_.site_->pos_[i_dim];
-    head_two_.pos_[i_dim] = head_two_.site_->pos_[i_dim];
-  }
+  head_one_.pos_ = head_one_.site_->GetPosition();
+  head_two_.pos_ = head_two_.site_->GetPosition();
   // printf("r1 = (%g, %g)\n", head_one_.pos_[0], head_one_.pos_[1]);
   // printf("r2 = (%g, %g)\n", head_two_.pos_[0], head_two_.pos_[1]);
   // Update spring position
@@ -44,13 +42,14 @@ int Protein::GetDirectionTowardRest(BindingHead *head) {
   if (n_heads_active_ == 1) {
     return 1;
   } else if (n_heads_active_ == 2) {
-    double x_static{head->GetOtherHead()->site_->pos_[0]};
-    double x_fwd{head->site_->pos_[0] + Params::Filaments::site_size};
-    double x_bck{head->site_->pos_[0] - Params::Filaments::site_size};
-    double r_x_fwd{x_fwd - x_static};
-    double r_x_bck{x_bck - x_static};
-    double r_x{head->site_->pos_[0] - x_static};
-    double r_y{head->site_->pos_[1] - head->GetOtherHead()->site_->pos_[1]};
+    Vec2 pos{head->site_->GetPosition()};
+    Vec2 pos_static{head->GetOtherHead()->site_->GetPosition()};
+    double x_fwd{pos[0] + Params::Filaments::site_size};
+    double x_bck{pos[0] - Params::Filaments::site_size};
+    double r_x_fwd{x_fwd - pos_static[0]};
+    double r_x_bck{x_bck - pos_static[0]};
+    double r_x{pos[0] - pos_static[0]};
+    double r_y{pos[1] - pos_static[1]};
     double r{sqrt(Square(r_x) + Square(r_y))};
     double r_fwd{sqrt(Square(r_x_fwd) + Square(r_y))};
     double r_bck{sqrt(Square(r_x_bck) + Square(r_y))};
@@ -85,45 +84,46 @@ double Protein::GetAnchorCoordinate(int i_dim) {
   if (n_heads_active_ != 2) {
     Sys::ErrorExit("Protein::GetAnchorCoord()");
   }
-  return (head_one_.site_->pos_[i_dim] + head_two_.site_->pos_[i_dim]) / 2;
+  return (head_one_.site_->GetPosition()[i_dim] +
+          head_two_.site_->GetPosition()[i_dim]) /
+         2;
 }
 
 void Protein::UpdateNeighbors_Bind_II() {
 
   n_neighbors_bind_ii_ = 0;
+  if (neighbors_bind_ii_.empty()) {
+    // Maximum possible x_distance of spring will occur when r_y = 0
+    using namespace Params;
+    size_t x_max{(size_t)std::ceil(spring_.r_max_ / Filaments::site_size)};
+    neighbors_bind_ii_.resize(2 * x_max + 1);
+    weights_bind_ii_.resize(2 * x_max + 1);
+  }
   BindingSite *site{GetActiveHead()->site_};
   Protofilament *neighb_fil{site->filament_->neighbor_};
   double r_y{site->filament_->pos_[1] - neighb_fil->pos_[1]};
   double r_x_max{sqrt(Square(spring_.r_max_) - Square(r_y))};
   int delta_max{(int)std::ceil(r_x_max / Params::Filaments::site_size)};
-  // BindingSite *scratch[neighbors_bind_ii_.size()];
-  for (int delta{-delta_max}; delta <= delta_max; delta++) {
-    BindingSite *neighb{neighb_fil->GetNeighb(site, delta)};
-    if (neighb == nullptr) {
-      continue;
-    }
-    if (neighb->occupant_ == nullptr) {
-      // scratch[n_neighbors_bind_ii_++] = neighb;
-      neighbors_bind_ii_[n_neighbors_bind_ii_++] = neighb;
-    }
+  int i_aligned{neighb_fil->GetAlignedIndex(site)};
+  int i_max{int(neighb_fil->sites_.size()) - 1};
+  int i_first{std::max(i_aligned - delta_max, 0)};
+  int i_last{std::min(i_aligned + delta_max, i_max)};
+  if (i_first > i_last) {
+    return;
   }
+  neighb_fil->ForEachUnoccupied(i_first, i_last, [&](BindingSite *neighb) {
+    neighbors_bind_ii_[n_neighbors_bind_ii_++] = neighb;
+  });
   // printf("%i neighbs\n", n_neighbors_bind_ii_);
-  // BindingSite *truncated[n_neighbors_bind_ii_];
-  // for (int i_entry{0}; i_entry < n_neighbors_bind_ii_; i_entry++) {
-  //   truncated[i_entry] = scratch[i_entry];
-  // }
-  // // Shuffle then transfer data
-  // SysRNG::Shuffle(truncated, n_neighbors_bind_ii_, sizeof(BindingSite *));
-  // for (int i_entry{0}; i_entry < n_neighbors_bind_ii_; i_entry++) {
-  //   neighbors_bind_ii_[i_entry] = truncated[i_entry];
-  // }
 }
 
 double Protein::GetSoloWeight_Bind_II(BindingSite *neighb) {
 
   BindingSite *site{GetActiveHead()->site_};
-  double r_x{neighb->pos_[0] - site->pos_[0]};
-  double r_y{neighb->pos_[1] - site->pos_[1]};
+  Vec2 pos{site->GetPosition()};
+  Vec2 pos_neighb{neighb->GetPosition()};
+  double r_x{pos_neighb[0] - pos[0]};
+  double r_y{pos_neighb[1] - pos[1]};
   double r{sqrt(Square(r_x) + Square(r_y))};
   // printf("r = %g\n", r);
   if (r < spring_.r_min_ or r > spring_.r_max_) {
@@ -140,14 +140,21 @@ double Protein::GetSoloWeight_Bind_II(BindingSite *neighb) {
 
 BindingSite *Protein::GetNeighbor_Bind_II() {
 
-  double weight_tot{GetWeight_Bind_II()};
-  double ran{SysRNG::GetRanProb()};
+  // Weights cached during sampling are still current unless occupancy has
+  // changed since then, i.e., if other events were executed this step
+  BindingSite *site{GetActiveHead()->site_};
+  if (site != site_bind_ii_ or !site->filament_->modified_sites_.empty() or
+      !site->filament_->neighbor_->modified_sites_.empty()) {
+    GetWeight_Bind_II();
+  }
+  double weight_tot{weight_bind_ii_tot_};
+  double ran{SysRNG::GetRanProb(SysRNG::Proteins)};
   double p_cum{0.0};
   Sys::Log(2, "%i NEIGHBS\n", n_neighbors_bind_ii_);
   Sys::Log(2, "ran = %g\n", ran);
   for (int i_neighb{0}; i_neighb < n_neighbors_bind_ii_; i_neighb++) {
     BindingSite *neighb{neighbors_bind_ii_[i_neighb]};
-    p_cum += GetSoloWeight_Bind_II(neighb) / weight_tot;
+    p_cum += weights_bind_ii_[i_neighb] / weight_tot;
     Sys::Log(2, "p_cum = %g\n", p_cum);
     if (ran < p_cum) {
       Sys::Log(2, "*** chose neighb %i ***\n\n", neighb->index_);
@@ -158,27 +165,8 @@ BindingSite *Protein::GetNeighbor_Bind_II() {
   return nullptr;
 }
 
-double Protein::GetWeight_Diffuse(BindingHead *head, int dir) {
+double Protein::GetWeight_Shift(BindingHead *head, int dx) {
 
-  if (n_heads_active_ != 2) {
-    Sys::ErrorExit("Protein::GetWeight_diffuse");
-  }
-  int dx{dir * head->GetDirectionTowardRest()};
-  // For xlinks exactly at rest,
-  if (dx == 0) {
-    // Diffuse from rest in a random direction
-    if (dir == -1) {
-      ran_ = SysRNG::GetRanProb();
-      if (ran_ < 0.5) {
-        dx = 1;
-      } else {
-        dx = -1;
-      }
-      // Impossible to diffuse toward rest
-    } else {
-      return 0.0;
-    }
-  }
   BindingSite *new_loc{head->site_->GetNeighbor(dx)};
   if (new_loc == nullptr) {
     return 0.0;
@@ -194,23 +182,47 @@ double Protein::GetWeight_Diffuse(BindingHead *head, int dir) {
   }
   BindingSite *static_loc{head->GetOtherHead()->site_};
   if (old_loc->filament_ == static_loc->filament_) {
-    Sys::ErrorExit("Protein::GetWeight_diffuse [2]");
+    Sys::ErrorExit("Protein::GetWeight_Shift()");
   }
   spring_.UpdatePosition();
-  double weight_spring{spring_.GetWeight_Shift(static_loc, old_loc, new_loc)};
+  double weight_spring{spring_.GetWeight_Shift(static_loc->GetPosition(),
+                                                new_loc->GetPosition())};
   double weight_neighb{head->site_->GetWeight_Unbind()};
   // printf("WT[%i] = %g\n", dx, weight_spring * weight_neighb);
   return weight_spring * weight_neighb;
 }
 
+double Protein::GetWeight_Diffuse(BindingHead *head, int dir) {
+
+  if (n_heads_active_ != 2) {
+    Sys::ErrorExit("Protein::GetWeight_diffuse");
+  }
+  int dx{dir * head->GetDirectionTowardRest()};
+  // For xlinks exactly at rest,
+  if (dx == 0) {
+    // Impossible to diffuse toward rest
+    if (dir == 1) {
+      return 0.0;
+    }
+    // Diffuse from rest in either direction w/ equal a priori probability;
+    // averaging (rather than picking one at random) keeps the weight cacheable
+    return 0.5 * (GetWeight_Shift(head, 1) + GetWeight_Shift(head, -1));
+  }
+  return GetWeight_Shift(head, dx);
+}
+
 double Protein::GetWeight_Bind_II() {
 
   // UpdateExtension();
   double tot_weight{0.0};
   UpdateNeighbors_Bind_II();
   for (int i_neighb{0}; i_neighb < n_neighbors_bind_ii_; i_neighb++) {
-    tot_weight += GetSoloWeight_Bind_II(neighbors_bind_ii_[i_neighb]);
+    weights_bind_ii_[i_neighb] =
+        GetSoloWeight_Bind_II(neighbors_bind_ii_[i_neighb]);
+    tot_weight += weights_bind_ii_[i_neighb];
   }
+  site_bind_ii_ = GetActiveHead()->site_;
+  weight_bind_ii_tot_ = tot_weight;
   return tot_weight;
 }
 
@@ -227,21 +239,23 @@ double Protein::GetWeight_Unbind_II(BindingHead *head) {
 bool Protein::Diffuse(BindingHead *head, int dir) {
 
   int dx{dir * head->GetDirectionTowardRest()};
-  // FIXME ran num MUST be synchronized with one in GetWeight() above
   // For xlinks exactly at rest,
   if (dx == 0) {
-    // Diffuse from rest in a random direction
-    if (dir == -1) {
-      if (ran_ < 0.5) {
-        dx = 1;
-      } else {
-        dx = -1;
-      }
-      // Impossible to diffuse toward rest
-    } else {
+    // Impossible to diffuse toward rest
+    if (dir == 1) {
       // printf("HAH on site %i\n", head->site_->index_);
       return false;
     }
+    // Diffuse from rest in a direction chosen w/ prob. proportional to its
+    // weight; combined w/ the averaged weight in GetWeight_Diffuse() above,
+    // this is equivalent to picking a direction at random beforehand
+    double weight_fwd{GetWeight_Shift(head, 1)};
+    double weight_bck{GetWeight_Shift(head, -1)};
+    if (weight_fwd + weight_bck == 0.0) {
+      return false;
+    }
+    double ran{SysRNG::GetRanProb(SysRNG::Proteins)};
+    dx = ran * (weight_fwd + weight_bck) < weight_fwd ? 1 : -1;
   }
   // printf("dx: %i\n", dx);
   BindingSite *old_site = head->site_;
@@ -257,8 +271,8 @@ bool Protein::Diffuse(BindingHead *head, int dir) {
     // printf("HAH on site %i\n", head->site_->index_);
     return false;
   }
-  old_site->occupant_ = nullptr;
-  new_site->occupant_ = head;
+  old_site->RemoveOccupant();
+  new_site->SetOccupant(head);
   head->site_ = new_site;
   // printf("frfr\n\n");
   return true;
@@ -269,7 +283,7 @@ bool Protein::Bind(BindingSite *site, BindingHead *head) {
   if (site->occupant_ != nullptr) {
     return false;
   }
-  site->occupant_ = head;
+  site->SetOccupant(head);
   head->site_ = site;
   n_heads_active_++;
   return true;
@@ -278,7 +292,7 @@ bool Protein::Bind(BindingSite *site, BindingHead *head) {
 bool Protein::Unbind(BindingHead *head) {
 
   BindingSite *site{head->site_};
-  site->occupant_ = nullptr;
+  site->RemoveOccupant();
   head->site_ = nullptr;
   n_heads_active_--;
   return true;
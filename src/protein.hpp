@@ -7,11 +7,15 @@
 
 class Protein : public Object {
 protected:
-  double ran_{0.0};
   int n_neighbors_bind_ii_{0};
   Vec<BindingSite *> neighbors_bind_ii_;
+  // Cached by GetWeight_Bind_II() so that GetNeighbor_Bind_II() can reuse them
+  BindingSite *site_bind_ii_{nullptr}; // Site of active head at time of caching
+  Vec<double> weights_bind_ii_;        // [i_neighb]; weight of each neighbor
+  double weight_bind_ii_tot_{0.0};
 
 public:
+  size_t pool_index_{0}; // Position in Reservoir; see GenerateEntry()
   size_t active_index_{0};
   size_t n_heads_active_{0};
 
@@ -39,9 +43,7 @@ public:
     //                       Xlinks::k_rot);
     // pivot_two_.Initialize(sid, id, &head_two_, &head_one_, Xlinks::theta_0,
     //                       Xlinks::k_rot);
-    // Maximum possible x_distance of spring will occur when r_y = 0
-    size_t x_max{(size_t)std::ceil(spring_.r_max_ / Filaments::site_size)};
-    neighbors_bind_ii_.resize(2 * x_max + 1);
+    // Neighbor lists are allocated once needed; see UpdateNeighbors_Bind_II()
   }
   int GetNumHeadsActive() { return n_heads_active_; }
   virtual BindingHead *GetHeadOne() { return &head_one_; }
@@ -60,7 +62,8 @@ public:
   bool HasSatellite();
   void UntetherSatellite();
 
-  virtual void ApplyLatticeDeformation() {}
+  virtual void ClearLatticeDeformation() {}
+  virtual void UpdateLatticeDeformation() {}
 
   virtual bool UpdateExtension();
   virtual int GetDirectionTowardRest(BindingHead *head);
@@ -70,6 +73,7 @@ public:
   virtual double GetSoloWeight_Bind_II(BindingSite *neighb);
   virtual BindingSite *GetNeighbor_Bind_II();
 
+  virtual double GetWeight_Shift(BindingHead *head, int dx);
   virtual double GetWeight_Diffuse(BindingHead *head, int dir);
   virtual double GetWeight_Bind_II();
   virtual double GetWeight_Unbind_II(BindingHead *head);
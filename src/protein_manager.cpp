@@ -87,9 +87,11 @@ void ProteinManager::InitializeWeights() {
   // motor; multiplied together to get total weight for any arrangement
   Sys::weight_lattice_bind_.resize(Sys::lattice_cutoff_ + 1);
   Sys::weight_lattice_unbind_.resize(Sys::lattice_cutoff_ + 1);
+  Sys::energy_lattice_.resize(Sys::lattice_cutoff_ + 1);
   for (int delta{0}; delta <= Sys::lattice_cutoff_; delta++) {
     double dx{delta * Params::Filaments::site_size};
     double energy{lattice_alpha * dx * dx + lattice_E_0_solo}; // in kbT
+    Sys::energy_lattice_[delta] = energy;
     Sys::weight_lattice_bind_[delta] = exp(-(1.0 - _lambda_lattice) * energy);
     Sys::weight_lattice_unbind_[delta] = exp(_lambda_lattice * energy);
     // printf("weight = %#.3g (%#.3g)\n", Sys::weight_lattice_bind_[delta],
@@ -567,11 +569,11 @@ void ProteinManager::InitializeTestEvents() {
   if (Sys::test_mode_ == "xlink_bind_ii") {
     // KMC Event -- Bind_II
     // Add population tracker for potential targets of Bind_II event
-    auto is_singly_bound = [](Object *protein) -> Vec<Object *> {
-      if (protein->GetNumHeadsActive() == 1) {
-        return {protein->GetActiveHead()};
+    auto is_singly_bound = [](Protein *protein,
+                              MemberList<BindingHead> &members) {
+      if (protein->n_heads_active_ == 1) {
+        members.push_back(protein->GetActiveHead());
       }
-      return {};
     };
     xlinks_.AddPop("bind_ii", is_singly_bound);
     // int x_max{int(test_stats_.at("bind_ii").size() - 1) / 2};
@@ -590,18 +592,15 @@ void ProteinManager::InitializeTestEvents() {
       }
       return SysRNG::SamplePoisson(p);
     };
-    auto get_weight_bind_ii = [](Object *base) {
-      auto head{dynamic_cast<BindingHead *>(base)};
+    auto get_weight_bind_ii = [](BindingHead *head) {
       return head->parent_->GetWeight_Bind_II();
     };
-    auto exe_bind_ii = [&](Object *base_head) {
-      auto bound_head{dynamic_cast<BindingHead *>(base_head)};
+    auto exe_bind_ii = [&](BindingHead *bound_head) {
       auto head{bound_head->GetOtherHead()};
       auto site{head->parent_->GetNeighbor_Bind_II()};
       auto executed{head->parent_->Bind(site, head)};
       if (executed) {
-        xlinks_.FlagForUpdate();
-        filaments_->FlagForUpdate();
+        xlinks_.FlagForUpdate(head->parent_);
         bool still_attached{head->parent_->UpdateExtension()};
         if (!still_attached) {
           return;
@@ -616,18 +615,17 @@ void ProteinManager::InitializeTestEvents() {
       }
     };
     // Construct KMC event fr Bind_II
-    kmc_.events_.emplace_back("bind_ii",
-                              xlinks_.p_event_.at("bind_ii").GetVal(),
-                              &xlinks_.sorted_.at("bind_ii").size_,
-                              &xlinks_.sorted_.at("bind_ii").entries_,
-                              poisson_bind_ii, get_weight_bind_ii, exe_bind_ii);
+    kmc_.AddEvent<BindingHead>(
+        "bind_ii", xlinks_.p_event_.at("bind_ii").GetVal(),
+        &xlinks_.sorted_.at("bind_ii"), poisson_bind_ii, get_weight_bind_ii,
+        exe_bind_ii);
     // KMC event -- Unbind_II
-    auto is_doubly_bound = [&](Object *protein) -> Vec<Object *> {
+    auto is_doubly_bound = [](Protein *protein,
+                              MemberList<BindingHead> &members) {
       // Only ever unbind second head
-      if (protein->GetNumHeadsActive() == 2) {
-        return {protein->GetHeadTwo()};
+      if (protein->n_heads_active_ == 2) {
+        members.push_back(&protein->head_two_);
       }
-      return {};
     };
     xlinks_.AddPop("unbind_ii", is_doubly_bound);
     auto poisson_unbind_ii = [&](double p, int n) {
@@ -644,16 +642,13 @@ void ProteinManager::InitializeTestEvents() {
       }
       return SysRNG::SamplePoisson(p);
     };
-    auto get_weight_unbind_ii = [](Object *base) {
-      auto head{dynamic_cast<BindingHead *>(base)};
+    auto get_weight_unbind_ii = [](BindingHead *head) {
       return head->GetWeight_Unbind_II();
     };
-    auto exe_unbind_ii = [&](Object *base) {
-      auto head{dynamic_cast<BindingHead *>(base)};
+    auto exe_unbind_ii = [&](BindingHead *head) {
       bool executed{head->Unbind()};
       if (executed) {
-        xlinks_.FlagForUpdate();
-        filaments_->FlagForUpdate();
+        xlinks_.FlagForUpdate(head->parent_);
         double r_x{head->pos_[0] - head->GetOtherHead()->pos_[0]};
         double offset(Filaments::x_initial[1] - Filaments::x_initial[0]);
         int x{(int)std::round((r_x - offset) / Params::Filaments::site_size)};
@@ -664,43 +659,39 @@ void ProteinManager::InitializeTestEvents() {
         Sys::ErrorExit("Unbind_II (TEST)");
       }
     };
-    kmc_.events_.emplace_back(
+    kmc_.AddEvent<BindingHead>(
         "unbind_ii", xlinks_.p_event_.at("unbind_ii").GetVal(),
-        &xlinks_.sorted_.at("unbind_ii").size_,
-        &xlinks_.sorted_.at("unbind_ii").entries_, poisson_unbind_ii,
+        &xlinks_.sorted_.at("unbind_ii"), poisson_unbind_ii,
         get_weight_unbind_ii, exe_unbind_ii);
   } else if (Sys::test_mode_ == "xlink_diffusion") {
-    auto is_doubly_bound = [](Object *protein) -> Vec<Object *> {
-      if (protein->GetNumHeadsActive() == 2) {
-        return {protein->GetHeadOne(), protein->GetHeadTwo()};
+    auto is_doubly_bound = [](Protein *protein,
+                              MemberList<BindingHead> &members) {
+      if (protein->n_heads_active_ == 2) {
+        members.push_back(&protein->head_one_);
+        members.push_back(&protein->head_two_);
       }
-      return {};
     };
     xlinks_.AddPop("diffuse_ii_to_rest", is_doubly_bound);
     xlinks_.AddPop("diffuse_ii_fr_rest", is_doubly_bound);
-    auto exe_diff_to = [&](Object *base) {
-      BindingHead *head{dynamic_cast<BindingHead *>(base)};
+    auto exe_diff_to = [&](BindingHead *head) {
       double r_x{head->pos_[0] - head->GetOtherHead()->pos_[0]};
       size_t x{
           (size_t)std::abs(std::round(r_x / Params::Filaments::site_size))};
       bool executed{head->Diffuse(1)};
       if (executed) {
         bool still_attached{head->parent_->UpdateExtension()};
-        xlinks_.FlagForUpdate();
-        filaments_->FlagForUpdate();
+        xlinks_.FlagForUpdate(head->parent_);
         test_stats_.at("to_rest")[x].first++;
       }
     };
-    auto exe_diff_fr = [&](Object *base) {
-      BindingHead *head{dynamic_cast<BindingHead *>(base)};
+    auto exe_diff_fr = [&](BindingHead *head) {
       double r_x{head->pos_[0] - head->GetOtherHead()->pos_[0]};
       size_t x{
           (size_t)std::abs(std::round(r_x / Params::Filaments::site_size))};
       bool executed{head->Diffuse(-1)};
       if (executed) {
         bool still_attached{head->parent_->UpdateExtension()};
-        xlinks_.FlagForUpdate();
-        filaments_->FlagForUpdate();
+        xlinks_.FlagForUpdate(head->parent_);
         test_stats_.at("fr_rest")[x].first++;
       }
     };
@@ -744,23 +735,17 @@ void ProteinManager::InitializeTestEvents() {
         return 0;
       }
     };
-    kmc_.events_.emplace_back(
+    kmc_.AddEvent<BindingHead>(
         "diffuse_ii_to_rest",
         xlinks_.p_event_.at("diffuse_ii_to_rest").GetVal(),
-        &xlinks_.sorted_.at("diffuse_ii_to_rest").size_,
-        &xlinks_.sorted_.at("diffuse_ii_to_rest").entries_, poisson_to,
-        [&](Object *base) {
-          return weight_diff_ii(dynamic_cast<BindingHead *>(base), 1);
-        },
+        &xlinks_.sorted_.at("diffuse_ii_to_rest"), poisson_to,
+        [=](BindingHead *head) { return weight_diff_ii(head, 1); },
         exe_diff_to);
-    kmc_.events_.emplace_back(
+    kmc_.AddEvent<BindingHead>(
         "diffuse_ii_fr_rest",
         xlinks_.p_event_.at("diffuse_ii_fr_rest").GetVal(),
-        &xlinks_.sorted_.at("diffuse_ii_fr_rest").size_,
-        &xlinks_.sorted_.at("diffuse_ii_fr_rest").entries_, poisson_fr,
-        [&](Object *base) {
-          return weight_diff_ii(dynamic_cast<BindingHead *>(base), -1);
-        },
+        &xlinks_.sorted_.at("diffuse_ii_fr_rest"), poisson_fr,
+        [=](BindingHead *head) { return weight_diff_ii(head, -1); },
         exe_diff_fr);
   } else if (Sys::test_mode_ == "motor_lattice_bind") {
     auto poisson = [&](double p, int n) {
@@ -775,29 +760,22 @@ void ProteinManager::InitializeTestEvents() {
         return 0;
       }
     };
-    auto exe_bind_i = [&](Object *base) {
-      BindingSite *site{dynamic_cast<BindingSite *>(base)};
+    auto exe_bind_i = [&](BindingSite *site) {
       int i_site{(int)site->index_};
       // 'main' kinesin motor will always be at index_ = lattice_cutoff_
       int delta{abs(i_site - (int)Motors::gaussian_range)};
       test_stats_.at("bind")[delta].first++;
-      filaments_->FlagForUpdate();
     };
     auto weight_bind_i = [](auto *site) { return site->GetWeight_Bind(); };
-    auto is_unocc = [](Object *site) -> Vec<Object *> {
+    auto is_unocc = [](BindingSite *site, MemberList<BindingSite> &members) {
       if (!site->IsOccupied()) {
-        return {site};
+        members.push_back(site);
       }
-      return {};
     };
     filaments_->AddPop("motors", is_unocc);
-    kmc_.events_.emplace_back(
+    kmc_.AddEvent<BindingSite>(
         "bind_i", motors_.p_event_.at("bind_i").GetVal(),
-        &filaments_->unoccupied_.at("motors").size_,
-        &filaments_->unoccupied_.at("motors").entries_, poisson,
-        [&](Object *base) {
-          return weight_bind_i(dynamic_cast<BindingSite *>(base));
-        },
+        &filaments_->unoccupied_.at("motors"), poisson, weight_bind_i,
         exe_bind_i);
   } else if (Sys::test_mode_ == "motor_lattice_step") {
     auto binomial = [&](double p, int n) {
@@ -812,27 +790,23 @@ void ProteinManager::InitializeTestEvents() {
       // printf("boop\n");
       bool executed{head->parent_->Bind_ATP(head)};
       if (executed) {
-        pop->FlagForUpdate();
+        pop->FlagForUpdate(head->parent_);
       }
     };
-    auto is_NULL_i_bound = [](auto *motor) -> Vec<Object *> {
+    auto is_NULL_i_bound = [](Motor *motor,
+                              MemberList<CatalyticHead> &members) {
       if (motor->n_heads_active_ == 1) {
         if (motor->GetActiveHead()->ligand_ == CatalyticHead::Ligand::NONE) {
-          return {motor->GetActiveHead()};
+          members.push_back(motor->GetActiveHead());
         }
       }
-      return {};
     };
-    motors_.AddPop("bound_i_NULL", [&](Object *base) {
-      return is_NULL_i_bound(dynamic_cast<Motor *>(base));
-    });
-    kmc_.events_.emplace_back(
+    motors_.AddPop("bound_i_NULL", is_NULL_i_bound);
+    kmc_.AddEvent<CatalyticHead>(
         "bind_ATP_i", motors_.p_event_.at("bind_ATP_i").GetVal(),
         &motors_.sorted_.at("bound_i_NULL").size_,
         &motors_.sorted_.at("bound_i_NULL").entries_, binomial,
-        [&](Object *base) {
-          exe_bind_ATP(dynamic_cast<CatalyticHead *>(base), &motors_);
-        });
+        [=](CatalyticHead *head) { exe_bind_ATP(head, &motors_); });
     // Bind_ATP_II
     auto poisson_ATP = [&](double p, int n) {
       if (p > 0.0) {
@@ -849,14 +823,14 @@ void ProteinManager::InitializeTestEvents() {
       bool unbound{rear_head->Unbind()};
       bool executed{front_head->parent_->Bind_ATP(front_head)};
       if (executed) {
-        pop->FlagForUpdate();
-        fil->FlagForUpdate();
+        pop->FlagForUpdate(front_head->parent_);
       }
     };
     auto weight_bind_ATP_ii = [](auto *head) {
       return head->parent_->GetWeight_BindATP_II(head);
     };
-    auto is_NULL_ii_bound = [](auto *motor) -> Vec<Object *> {
+    auto is_NULL_ii_bound = [](Motor *motor,
+                               MemberList<CatalyticHead> &members) {
       if (motor->n_heads_active_ == 2) {
         bool found_head{false};
         CatalyticHead *chosen_head{nullptr};
@@ -870,53 +844,39 @@ void ProteinManager::InitializeTestEvents() {
           chosen_head = &motor->head_two_;
         }
         if (chosen_head != nullptr) {
-          return {chosen_head};
+          members.push_back(chosen_head);
         }
       }
-      return {};
     };
-    motors_.AddPop("bound_ii_NULL", [&](Object *base) {
-      return is_NULL_ii_bound(dynamic_cast<Motor *>(base));
-    });
-    kmc_.events_.emplace_back(
+    motors_.AddPop("bound_ii_NULL", is_NULL_ii_bound);
+    kmc_.AddEvent<CatalyticHead>(
         "bind_ATP_ii", motors_.p_event_.at("bind_ATP_ii").GetVal(),
-        &motors_.sorted_.at("bound_ii_NULL").size_,
-        &motors_.sorted_.at("bound_ii_NULL").entries_, poisson_ATP,
-        [&](Object *base) {
-          return weight_bind_ATP_ii(dynamic_cast<CatalyticHead *>(base));
-        },
-        [&](Object *base) {
-          exe_bind_ATP_ii(dynamic_cast<CatalyticHead *>(base), &motors_,
-                          filaments_);
+        &motors_.sorted_.at("bound_ii_NULL"), poisson_ATP, weight_bind_ATP_ii,
+        [=](CatalyticHead *head) {
+          exe_bind_ATP_ii(head, &motors_, filaments_);
         });
     // Hydrolyze
     auto exe_hydrolyze = [](auto *head, auto *pop) {
       bool executed{head->parent_->Hydrolyze(head)};
       if (executed) {
-        pop->FlagForUpdate();
+        pop->FlagForUpdate(head->parent_);
       }
     };
-    auto is_ATP_i_bound = [](auto *motor) -> Vec<Object *> {
+    auto is_ATP_i_bound = [](Motor *motor, MemberList<CatalyticHead> &members) {
       if (motor->n_heads_active_ == 1) {
         if (motor->GetActiveHead()->ligand_ == CatalyticHead::Ligand::ATP) {
-          return {motor->GetActiveHead()};
+          members.push_back(motor->GetActiveHead());
         }
       }
-      return {};
     };
-    motors_.AddPop("bound_i_ATP", [&](Object *base) {
-      return is_ATP_i_bound(dynamic_cast<Motor *>(base));
-    });
-    kmc_.events_.emplace_back(
+    motors_.AddPop("bound_i_ATP", is_ATP_i_bound);
+    kmc_.AddEvent<CatalyticHead>(
         "hydrolyze", motors_.p_event_.at("hydrolyze").GetVal(),
         &motors_.sorted_.at("bound_i_ATP").size_,
         &motors_.sorted_.at("bound_i_ATP").entries_, binomial,
-        [&](Object *base) {
-          exe_hydrolyze(dynamic_cast<CatalyticHead *>(base), &motors_);
-        });
+        [=](CatalyticHead *head) { exe_hydrolyze(head, &motors_); });
     // Bind_II
-    auto exe_bind_ii = [&](Object *base) {
-      auto bound_head{dynamic_cast<CatalyticHead *>(base)};
+    auto exe_bind_ii = [&](CatalyticHead *bound_head) {
       auto head{bound_head->GetOtherHead()};
       auto site{head->parent_->GetNeighbor_Bind_II()};
       // If dock site is plus end, unbind motor and place it on minus end
@@ -931,8 +891,7 @@ void ProteinManager::InitializeTestEvents() {
       auto executed{head->parent_->Bind(site, head)};
       if (executed) {
         bool still_attached{head->parent_->UpdateExtension()};
-        motors_.FlagForUpdate();
-        filaments_->FlagForUpdate();
+        motors_.FlagForUpdate(head->parent_);
         test_stats_.at("bind_ii")[0].first++;
       }
     };
@@ -948,31 +907,22 @@ void ProteinManager::InitializeTestEvents() {
         return 0;
       }
     };
-    auto is_docked = [](auto *motor) -> Vec<Object *> {
+    auto is_docked = [](Motor *motor, MemberList<CatalyticHead> &members) {
       auto *docked_head{motor->GetDockedHead()};
       if (docked_head != nullptr) {
-        return {docked_head->GetOtherHead()};
+        members.push_back(docked_head->GetOtherHead());
       }
-      return {};
     };
-    motors_.AddPop("bind_ii", [&](Object *base) {
-      return is_docked(dynamic_cast<Motor *>(base));
-    });
-    kmc_.events_.emplace_back(
+    motors_.AddPop("bind_ii", is_docked);
+    kmc_.AddEvent<CatalyticHead>(
         "bind_ii", motors_.p_event_.at("bind_ii").GetVal(),
-        &motors_.sorted_.at("bind_ii").size_,
-        &motors_.sorted_.at("bind_ii").entries_, poisson_bind_ii,
-        [&](Object *base) {
-          return weight_bind_ii(dynamic_cast<CatalyticHead *>(base));
-        },
+        &motors_.sorted_.at("bind_ii"), poisson_bind_ii, weight_bind_ii,
         exe_bind_ii);
     // Unbind_II
-    auto exe_unbind_ii = [&](Object *base) {
-      auto head{dynamic_cast<CatalyticHead *>(base)};
+    auto exe_unbind_ii = [&](CatalyticHead *head) {
       bool executed{head->Unbind()};
       if (executed) {
-        motors_.FlagForUpdate();
-        filaments_->FlagForUpdate();
+        motors_.FlagForUpdate(head->parent_);
         test_stats_.at("unbind_ii")[0].first++;
       }
     };
@@ -989,7 +939,8 @@ void ProteinManager::InitializeTestEvents() {
     auto weight_unbind_ii = [](auto *head) {
       return head->GetWeight_Unbind_II();
     };
-    auto is_ADPP_ii_bound = [](auto *motor) -> Vec<Object *> {
+    auto is_ADPP_ii_bound = [](Motor *motor,
+                               MemberList<CatalyticHead> &members) {
       if (motor->n_heads_active_ == 2) {
         bool found_head{false};
         CatalyticHead *chosen_head{nullptr};
@@ -1003,27 +954,19 @@ void ProteinManager::InitializeTestEvents() {
           chosen_head = &motor->head_two_;
         }
         if (chosen_head != nullptr) {
-          return {chosen_head};
+          members.push_back(chosen_head);
         }
       }
-      return {};
     };
-    motors_.AddPop("unbind_ii", [&](Object *base) {
-      return is_ADPP_ii_bound(dynamic_cast<Motor *>(base));
-    });
-    kmc_.events_.emplace_back(
+    motors_.AddPop("unbind_ii", is_ADPP_ii_bound);
+    kmc_.AddEvent<CatalyticHead>(
         "unbind_ii", motors_.p_event_.at("unbind_ii").GetVal(),
-        &motors_.sorted_.at("unbind_ii").size_,
-        &motors_.sorted_.at("unbind_ii").entries_, poisson_unbind_ii,
-        [&](Object *base) {
-          return weight_unbind_ii(dynamic_cast<CatalyticHead *>(base));
-        },
+        &motors_.sorted_.at("unbind_ii"), poisson_unbind_ii, weight_unbind_ii,
         exe_unbind_ii);
     // Unbind_I
-    auto exe_unbind_i = [&](Object *base) {
+    auto exe_unbind_i = [&](CatalyticHead *head) {
       // Count stats for unbind_i but do not actually execute it
       test_stats_.at("unbind_i")[0].first++;
-      filaments_->FlagForUpdate();
     };
     auto poisson_unbind_i = [&](double p, int n) {
       test_stats_.at("unbind_i")[0].second +=
@@ -1037,24 +980,18 @@ void ProteinManager::InitializeTestEvents() {
     auto weight_unbind_i = [](auto *head) {
       return head->parent_->GetWeight_Unbind_I();
     };
-    auto is_ADPP_i_bound = [](auto *motor) -> Vec<Object *> {
+    auto is_ADPP_i_bound = [](Motor *motor,
+                              MemberList<CatalyticHead> &members) {
       if (motor->n_heads_active_ == 1) {
         if (motor->GetActiveHead()->ligand_ == CatalyticHead::Ligand::ADPP) {
-          return {motor->GetActiveHead()};
+          members.push_back(motor->GetActiveHead());
         }
       }
-      return {};
     };
-    motors_.AddPop("bound_i_ADPP", [&](Object *base) {
-      return is_ADPP_i_bound(dynamic_cast<Motor *>(base));
-    });
-    kmc_.events_.emplace_back(
+    motors_.AddPop("bound_i_ADPP", is_ADPP_i_bound);
+    kmc_.AddEvent<CatalyticHead>(
         "unbind_i", motors_.p_event_.at("unbind_i").GetVal(),
-        &motors_.sorted_.at("bound_i_ADPP").size_,
-        &motors_.sorted_.at("bound_i_ADPP").entries_, poisson_unbind_i,
-        [&](Object *base) {
-          return weight_unbind_i(dynamic_cast<CatalyticHead *>(base));
-        },
+        &motors_.sorted_.at("bound_i_ADPP"), poisson_unbind_i, weight_unbind_i,
         exe_unbind_i);
   } else if (Sys::test_mode_ == "filament_separation") {
     // Poisson distribution; sampled to predict events w/ variable probabilities
@@ -1068,16 +1005,16 @@ void ProteinManager::InitializeTestEvents() {
         return 0;
       }
     };
-    auto is_doubly_bound = [&](Object *protein) -> Vec<Object *> {
-      if (protein->GetNumHeadsActive() == 2) {
-        return {protein->GetHeadOne(), protein->GetHeadTwo()};
+    auto is_doubly_bound = [](Protein *protein,
+                              MemberList<BindingHead> &members) {
+      if (protein->n_heads_active_ == 2) {
+        members.push_back(&protein->head_one_);
+        members.push_back(&protein->head_two_);
       }
-      return {};
     };
     xlinks_.AddPop("diffuse_ii_to_rest", is_doubly_bound);
     xlinks_.AddPop("diffuse_ii_fr_rest", is_doubly_bound);
-    auto exe_diffuse_fwd = [&](Object *base) {
-      auto head{dynamic_cast<BindingHead *>(base)};
+    auto exe_diffuse_fwd = [&](BindingHead *head) {
       bool executed{head->Diffuse(1)};
       if (executed) {
         bool still_attached{head->parent_->UpdateExtension()};
@@ -1086,11 +1023,9 @@ void ProteinManager::InitializeTestEvents() {
         }
         // FIXME had to move this from if statement above -- why ?
       }
-      filaments_->FlagForUpdate();
-      xlinks_.FlagForUpdate();
+      xlinks_.FlagForUpdate(head->parent_);
     };
-    auto exe_diffuse_bck = [&](Object *base) {
-      auto head{dynamic_cast<BindingHead *>(base)};
+    auto exe_diffuse_bck = [&](BindingHead *head) {
       bool executed{head->Diffuse(-1)};
       if (executed) {
         bool still_attached{head->parent_->UpdateExtension()};
@@ -1098,30 +1033,25 @@ void ProteinManager::InitializeTestEvents() {
         }
         // FIXME had to move this from if statement above -- why ?
       }
-      filaments_->FlagForUpdate();
-      xlinks_.FlagForUpdate();
+      xlinks_.FlagForUpdate(head->parent_);
     };
-    auto get_weight_diff_ii_to = [](Object *base) {
+    auto get_weight_diff_ii_to = [](BindingHead *head) {
       // printf("HI\n");
-      auto head{dynamic_cast<BindingHead *>(base)};
       return head->GetWeight_Diffuse(1);
     };
-    auto get_weight_diff_ii_fr = [](Object *base) {
+    auto get_weight_diff_ii_fr = [](BindingHead *head) {
       // printf("HII\n");
-      auto head{dynamic_cast<BindingHead *>(base)};
       return head->GetWeight_Diffuse(-1);
     };
-    kmc_.events_.emplace_back(
+    kmc_.AddEvent<BindingHead>(
         "diffuse_ii_to_rest",
         xlinks_.p_event_.at("diffuse_ii_to_rest").GetVal(),
-        &xlinks_.sorted_.at("diffuse_ii_to_rest").size_,
-        &xlinks_.sorted_.at("diffuse_ii_to_rest").entries_, poisson,
+        &xlinks_.sorted_.at("diffuse_ii_to_rest"), poisson,
         get_weight_diff_ii_to, exe_diffuse_fwd);
-    kmc_.events_.emplace_back(
+    kmc_.AddEvent<BindingHead>(
         "diffuse_ii_fr_rest",
         xlinks_.p_event_.at("diffuse_ii_fr_rest").GetVal(),
-        &xlinks_.sorted_.at("diffuse_ii_fr_rest").size_,
-        &xlinks_.sorted_.at("diffuse_ii_fr_rest").entries_, poisson,
+        &xlinks_.sorted_.at("diffuse_ii_fr_rest"), poisson,
         get_weight_diff_ii_fr, exe_diffuse_bck);
   } else if (Sys::test_mode_ == "filament_ablation") {
     InitializeEvents();
@@ -1155,27 +1085,19 @@ void ProteinManager::InitializeTestEvents() {
       bool executed{entry->Bind(site, &entry->head_one_)};
       if (executed) {
         pop->AddToActive(entry);
-        fil->FlagForUpdate();
       }
     };
     auto weight_bind_i = [](auto *site) { return site->GetWeight_Bind(); };
-    auto is_unocc = [](Object *site) -> Vec<Object *> {
+    auto is_unocc = [](BindingSite *site, MemberList<BindingSite> &members) {
       if (!site->IsOccupied()) {
-        return {site};
+        members.push_back(site);
       }
-      return {};
     };
     filaments_->AddPop("motors", is_unocc);
-    kmc_.events_.emplace_back(
+    kmc_.AddEvent<BindingSite>(
         "bind_i", motors_.p_event_.at("bind_i").GetVal(),
-        &filaments_->unoccupied_.at("motors").size_,
-        &filaments_->unoccupied_.at("motors").entries_, poisson,
-        [&](Object *base) {
-          return weight_bind_i(dynamic_cast<BindingSite *>(base));
-        },
-        [&](Object *base) {
-          exe_bind_i(dynamic_cast<BindingSite *>(base), &motors_, filaments_);
-        });
+        &filaments_->unoccupied_.at("motors"), poisson, weight_bind_i,
+        [=](BindingSite *site) { exe_bind_i(site, &motors_, filaments_); });
     // Bind_II
     auto exe_bind_ii = [](auto *bound_head, auto *pop, auto *fil) {
       auto head{bound_head->GetOtherHead()};
@@ -1183,51 +1105,41 @@ void ProteinManager::InitializeTestEvents() {
       auto executed{head->parent_->Bind(site, head)};
       if (executed) {
         bool still_attached{head->parent_->UpdateExtension()};
-        pop->FlagForUpdate();
-        fil->FlagForUpdate();
+        pop->FlagForUpdate(head->parent_);
       }
     };
     auto weight_bind_ii = [](auto *head) {
       return head->parent_->GetWeight_Bind_II();
     };
-    auto is_docked = [](auto *motor) -> Vec<Object *> {
+    auto is_docked = [](Motor *motor, MemberList<CatalyticHead> &members) {
       auto *docked_head{motor->GetDockedHead()};
       if (docked_head != nullptr) {
-        return {docked_head->GetOtherHead()};
+        members.push_back(docked_head->GetOtherHead());
       }
-      return {};
     };
-    motors_.AddPop("bind_ii", [&](Object *base) {
-      return is_docked(dynamic_cast<Motor *>(base));
-    });
-    kmc_.events_.emplace_back(
+    motors_.AddPop("bind_ii", is_docked);
+    kmc_.AddEvent<CatalyticHead>(
         "bind_ii", motors_.p_event_.at("bind_ii").GetVal(),
-        &motors_.sorted_.at("bind_ii").size_,
-        &motors_.sorted_.at("bind_ii").entries_, poisson,
-        [&](Object *base) {
-          return weight_bind_ii(dynamic_cast<CatalyticHead *>(base));
-        },
-        [&](Object *base) {
-          exe_bind_ii(dynamic_cast<CatalyticHead *>(base), &motors_,
-                      filaments_);
-        });
+        &motors_.sorted_.at("bind_ii"), poisson, weight_bind_ii,
+        [=](CatalyticHead *head) { exe_bind_ii(head, &motors_, filaments_); });
     // Unbind_II
     auto exe_unbind_ii = [](auto *head, auto *pop, auto *fil) {
       bool executed{head->Unbind()};
       if (executed) {
-        pop->FlagForUpdate();
-        fil->FlagForUpdate();
+        pop->FlagForUpdate(head->parent_);
       }
     };
     auto weight_unbind_ii = [](auto *head) {
       return head->GetWeight_Unbind_II();
     };
-    auto is_ADPP_ii_bound = [](auto *motor) -> Vec<Object *> {
+    auto is_ADPP_ii_bound = [](Motor *motor,
+                               MemberList<CatalyticHead> &members) {
       if (motor->n_heads_active_ == 2) {
         // Always unbind active head first if both are ADPP bound
         if (motor->head_one_.ligand_ == CatalyticHead::Ligand::ADPP and
             motor->head_two_.ligand_ == CatalyticHead::Ligand::ADPP) {
-          return {&motor->head_one_};
+          members.push_back(&motor->head_one_);
+          return;
         }
         bool found_head{false};
         CatalyticHead *chosen_head{nullptr};
@@ -1241,24 +1153,16 @@ void ProteinManager::InitializeTestEvents() {
           chosen_head = &motor->head_two_;
         }
         if (chosen_head != nullptr) {
-          return {chosen_head};
+          members.push_back(chosen_head);
         }
       }
-      return {};
     };
-    motors_.AddPop("unbind_ii", [&](Object *base) {
-      return is_ADPP_ii_bound(dynamic_cast<Motor *>(base));
-    });
-    kmc_.events_.emplace_back(
+    motors_.AddPop("unbind_ii", is_ADPP_ii_bound);
+    kmc_.AddEvent<CatalyticHead>(
         "unbind_ii", motors_.p_event_.at("unbind_ii").GetVal(),
-        &motors_.sorted_.at("unbind_ii").size_,
-        &motors_.sorted_.at("unbind_ii").entries_, poisson,
-        [&](Object *base) {
-          return weight_unbind_ii(dynamic_cast<CatalyticHead *>(base));
-        },
-        [&](Object *base) {
-          exe_unbind_ii(dynamic_cast<CatalyticHead *>(base), &motors_,
-                        filaments_);
+        &motors_.sorted_.at("unbind_ii"), poisson, weight_unbind_ii,
+        [=](CatalyticHead *head) {
+          exe_unbind_ii(head, &motors_, filaments_);
         });
     // Unbind_I: Unbind first (singly bound) head of a protein
     auto exe_unbind_i = [](auto *head, auto *pop, auto *fil) {
@@ -1266,134 +1170,104 @@ void ProteinManager::InitializeTestEvents() {
       if (executed) {
         head->UntetherSatellite();
         pop->RemoveFromActive(head->parent_);
-        fil->FlagForUpdate();
       }
     };
     auto weight_unbind_i = [](auto *head) {
       return head->parent_->GetWeight_Unbind_I();
     };
-    auto is_ADPP_i_bound = [](auto *motor) -> Vec<Object *> {
+    auto is_ADPP_i_bound = [](Motor *motor,
+                              MemberList<CatalyticHead> &members) {
       if (motor->n_heads_active_ == 1) {
         if (motor->GetActiveHead()->ligand_ == CatalyticHead::Ligand::ADPP) {
-          return {motor->GetActiveHead()};
+          members.push_back(motor->GetActiveHead());
         }
       }
-      return {};
     };
-    motors_.AddPop("bound_i_ADPP", [&](Object *base) {
-      return is_ADPP_i_bound(dynamic_cast<Motor *>(base));
-    });
-    kmc_.events_.emplace_back(
+    motors_.AddPop("bound_i_ADPP", is_ADPP_i_bound);
+    kmc_.AddEvent<CatalyticHead>(
         "unbind_i", motors_.p_event_.at("unbind_i").GetVal(),
-        &motors_.sorted_.at("bound_i_ADPP").size_,
-        &motors_.sorted_.at("bound_i_ADPP").entries_, poisson,
-        [&](Object *base) {
-          return weight_unbind_i(dynamic_cast<CatalyticHead *>(base));
-        },
-        [&](Object *base) {
-          exe_unbind_i(dynamic_cast<CatalyticHead *>(base), &motors_,
-                       filaments_);
-        });
+        &motors_.sorted_.at("bound_i_ADPP"), poisson, weight_unbind_i,
+        [=](CatalyticHead *head) { exe_unbind_i(head, &motors_, filaments_); });
     // Bind_ATP
     auto exe_bind_ATP = [](auto *head, auto *pop) {
       // printf("boop\n");
       bool executed{head->parent_->Bind_ATP(head)};
       if (executed) {
-        pop->FlagForUpdate();
+        pop->FlagForUpdate(head->parent_);
       }
     };
-    auto is_NULL_i_bound = [](auto *motor) -> Vec<Object *> {
+    auto is_NULL_i_bound = [](Motor *motor,
+                              MemberList<CatalyticHead> &members) {
       if (motor->n_heads_active_ == 1) {
         if (motor->GetActiveHead()->ligand_ == CatalyticHead::Ligand::NONE) {
-          return {motor->GetActiveHead()};
+          members.push_back(motor->GetActiveHead());
         }
       }
-      return {};
     };
-    motors_.AddPop("bound_i_NULL", [&](Object *base) {
-      return is_NULL_i_bound(dynamic_cast<Motor *>(base));
-    });
-    kmc_.events_.emplace_back(
+    motors_.AddPop("bound_i_NULL", is_NULL_i_bound);
+    kmc_.AddEvent<CatalyticHead>(
         "bind_ATP_i", motors_.p_event_.at("bind_ATP_i").GetVal(),
         &motors_.sorted_.at("bound_i_NULL").size_,
         &motors_.sorted_.at("bound_i_NULL").entries_, binomial,
-        [&](Object *base) {
-          exe_bind_ATP(dynamic_cast<CatalyticHead *>(base), &motors_);
-        });
+        [=](CatalyticHead *head) { exe_bind_ATP(head, &motors_); });
     // Hydrolyze_ATP
     if (motors_.active_) {
       auto exe_hydrolyze = [](auto *head, auto *pop) {
         bool executed{head->parent_->Hydrolyze(head)};
         if (executed) {
-          pop->FlagForUpdate();
+          pop->FlagForUpdate(head->parent_);
         }
       };
-      auto is_ATP_i_bound = [](auto *motor) -> Vec<Object *> {
+      auto is_ATP_i_bound = [](Motor *motor,
+                               MemberList<CatalyticHead> &members) {
         if (motor->n_heads_active_ == 1) {
           if (motor->GetActiveHead()->ligand_ == CatalyticHead::Ligand::ATP) {
-            return {motor->GetActiveHead()};
+            members.push_back(motor->GetActiveHead());
           }
         }
-        return {};
       };
-      motors_.AddPop("bound_i_ATP", [&](Object *base) {
-        return is_ATP_i_bound(dynamic_cast<Motor *>(base));
-      });
-      kmc_.events_.emplace_back(
+      motors_.AddPop("bound_i_ATP", is_ATP_i_bound);
+      kmc_.AddEvent<CatalyticHead>(
           "hydrolyze", motors_.p_event_.at("hydrolyze").GetVal(),
           &motors_.sorted_.at("bound_i_ATP").size_,
           &motors_.sorted_.at("bound_i_ATP").entries_, binomial,
-          [&](Object *base) {
-            exe_hydrolyze(dynamic_cast<CatalyticHead *>(base), &motors_);
-          });
+          [=](CatalyticHead *head) { exe_hydrolyze(head, &motors_); });
     }
     // Diffusion
     auto exe_diff = [](auto *head, auto *pop, auto *fil, int dir) {
       bool executed{head->Diffuse(dir)};
       if (executed) {
-        pop->FlagForUpdate();
-        fil->FlagForUpdate();
+        pop->FlagForUpdate(head->parent_);
       }
     };
-    auto is_singly_bound = [](auto *protein) -> Vec<Object *> {
+    auto is_singly_bound = [](Motor *protein,
+                              MemberList<CatalyticHead> &members) {
       if (protein->n_heads_active_ == 1) {
         // only head_two can diffuse
         if (protein->GetActiveHead() == &protein->head_two_) {
-          return {&protein->head_two_};
+          members.push_back(&protein->head_two_);
         }
       }
-      return {};
     };
-    Vec<int> i_min{0, 0, 0};
     Vec<size_t> dim_size{1, 1, _n_neighbs_max + 1};
-    auto get_n_neighbs = [](auto *entry) {
-      Vec<int> indices_vec{entry->GetNumNeighborsOccupied()};
-      return indices_vec;
-    };
-    motors_.AddPop(
-        "bound_i",
-        [&](Object *base) {
-          return is_singly_bound(dynamic_cast<Motor *>(base));
-        },
-        dim_size, i_min, get_n_neighbs);
+    auto get_n_neighbs = [](auto *entry, BinIndices &indices) {
+      indices.push_back(entry->GetNumNeighborsOccupied());
+    };
+    motors_.AddPop("bound_i", is_singly_bound, dim_size, get_n_neighbs);
     for (int n_neighbs{0}; n_neighbs < _n_neighbs_max; n_neighbs++) {
-      kmc_.events_.emplace_back(
+      kmc_.AddEvent<CatalyticHead>(
           "diffuse_i_fwd",
           xlinks_.p_event_.at("diffuse_i_fwd").GetVal(n_neighbs),
-          &motors_.sorted_.at("bound_i").bin_size_[0][0][n_neighbs],
-          &motors_.sorted_.at("bound_i").bin_entries_[0][0][n_neighbs],
-          binomial, [&](Object *base) {
-            exe_diff(dynamic_cast<BindingHead *>(base), &xlinks_, filaments_,
-                     1);
+          motors_.sorted_.at("bound_i").GetBin(0, 0, n_neighbs),
+          binomial, [=](CatalyticHead *head) {
+            exe_diff(head, &motors_, filaments_, 1);
           });
-      kmc_.events_.emplace_back(
+      kmc_.AddEvent<CatalyticHead>(
           "diffuse_i_bck",
           xlinks_.p_event_.at("diffuse_i_bck").GetVal(n_neighbs),
-          &motors_.sorted_.at("bound_i").bin_size_[0][0][n_neighbs],
-          &motors_.sorted_.at("bound_i").bin_entries_[0][0][n_neighbs],
-          binomial, [&](Object *base) {
-            exe_diff(dynamic_cast<BindingHead *>(base), &xlinks_, filaments_,
-                     -1);
+          motors_.sorted_.at("bound_i").GetBin(0, 0, n_neighbs),
+          binomial, [=](CatalyticHead *head) {
+            exe_diff(head, &motors_, filaments_, -1);
           });
     }
   }
@@ -1435,46 +1309,34 @@ void ProteinManager::InitializeEvents() {
     bool executed{entry->Bind(site, &entry->head_one_)};
     if (executed) {
       pop->AddToActive(entry);
-      fil->FlagForUpdate();
     }
   };
   auto weight_bind_i = [](auto *site) { return site->GetWeight_Bind(); };
-  auto is_unocc = [](Object *site) -> Vec<Object *> {
+  auto is_unocc = [](BindingSite *site, MemberList<BindingSite> &members) {
     if (!site->IsOccupied()) {
-      return {site};
+      members.push_back(site);
     }
-    return {};
   };
-  Vec<int> i_min{0, 0, 0};
   Vec<size_t> dim_size{1, 1, _n_neighbs_max + 1};
-  auto get_n_neighbs = [](Object *entry) {
-    Vec<int> indices_vec{entry->GetNumNeighborsOccupied()};
-    return indices_vec;
+  auto get_n_neighbs = [](auto *entry, BinIndices &indices) {
+    indices.push_back(entry->GetNumNeighborsOccupied());
   };
   if (xlinks_.active_) {
-    filaments_->AddPop("xlinks", is_unocc, dim_size, i_min, get_n_neighbs);
+    filaments_->AddPop("xlinks", is_unocc, dim_size, get_n_neighbs);
     for (int n_neighbs{0}; n_neighbs <= _n_neighbs_max; n_neighbs++) {
-      kmc_.events_.emplace_back(
+      kmc_.AddEvent<BindingSite>(
           "bind_i", xlinks_.p_event_.at("bind_i").GetVal(n_neighbs),
-          &filaments_->unoccupied_.at("xlinks").bin_size_[0][0][n_neighbs],
-          &filaments_->unoccupied_.at("xlinks").bin_entries_[0][0][n_neighbs],
-          binomial, [&](Object *base) {
-            exe_bind_i(dynamic_cast<BindingSite *>(base), &xlinks_, filaments_);
-          });
+          filaments_->unoccupied_.at("xlinks").GetBin(0, 0, n_neighbs),
+          binomial,
+          [=](BindingSite *site) { exe_bind_i(site, &xlinks_, filaments_); });
     }
   }
   if (motors_.active_) {
     filaments_->AddPop("motors", is_unocc);
-    kmc_.events_.emplace_back(
+    kmc_.AddEvent<BindingSite>(
         "bind_i", motors_.p_event_.at("bind_i").GetVal(),
-        &filaments_->unoccupied_.at("motors").size_,
-        &filaments_->unoccupied_.at("motors").entries_, poisson,
-        [&](Object *base) {
-          return weight_bind_i(dynamic_cast<BindingSite *>(base));
-        },
-        [&](Object *base) {
-          exe_bind_i(dynamic_cast<BindingSite *>(base), &motors_, filaments_);
-        });
+        &filaments_->unoccupied_.at("motors"), poisson, weight_bind_i,
+        [=](BindingSite *site) { exe_bind_i(site, &motors_, filaments_); });
   }
   // Bind_I_Teth
 
@@ -1486,88 +1348,65 @@ void ProteinManager::InitializeEvents() {
     auto executed{head->parent_->Bind(site, head)};
     if (executed) {
       bool still_attached{head->parent_->UpdateExtension()};
-      pop->FlagForUpdate();
-      fil->FlagForUpdate();
+      pop->FlagForUpdate(head->parent_);
     }
   };
   auto weight_bind_ii = [](auto *head) {
     return head->parent_->GetWeight_Bind_II();
   };
-  auto is_singly_bound = [](Object *protein) -> Vec<Object *> {
-    if (protein->GetNumHeadsActive() == 1) {
-      return {protein->GetActiveHead()};
+  auto is_singly_bound = [](Protein *protein,
+                            MemberList<BindingHead> &members) {
+    if (protein->n_heads_active_ == 1) {
+      members.push_back(protein->GetActiveHead());
     }
-    return {};
   };
   if (xlinks_.crosslinking_active_) {
     xlinks_.AddPop("bind_ii", is_singly_bound);
-    kmc_.events_.emplace_back(
+    kmc_.AddEvent<BindingHead>(
         "bind_ii", xlinks_.p_event_.at("bind_ii").GetVal(),
-        &xlinks_.sorted_.at("bind_ii").size_,
-        &xlinks_.sorted_.at("bind_ii").entries_, poisson,
-        [&](Object *base) {
-          return weight_bind_ii(dynamic_cast<BindingHead *>(base));
-        },
-        [&](Object *base) {
-          exe_bind_ii(dynamic_cast<BindingHead *>(base), &xlinks_, filaments_);
-        });
+        &xlinks_.sorted_.at("bind_ii"), poisson, weight_bind_ii,
+        [=](BindingHead *head) { exe_bind_ii(head, &xlinks_, filaments_); });
   }
   if (motors_.active_) {
-    auto is_docked = [](auto *motor) -> Vec<Object *> {
+    auto is_docked = [](Motor *motor, MemberList<CatalyticHead> &members) {
       auto *docked_head{motor->GetDockedHead()};
       if (docked_head != nullptr) {
-        return {docked_head->GetOtherHead()};
+        members.push_back(docked_head->GetOtherHead());
       }
-      return {};
     };
-    motors_.AddPop("bind_ii", [&](Object *base) {
-      return is_docked(dynamic_cast<Motor *>(base));
-    });
-    kmc_.events_.emplace_back(
+    motors_.AddPop("bind_ii", is_docked);
+    kmc_.AddEvent<CatalyticHead>(
         "bind_ii", motors_.p_event_.at("bind_ii").GetVal(),
-        &motors_.sorted_.at("bind_ii").size_,
-        &motors_.sorted_.at("bind_ii").entries_, poisson,
-        [&](Object *base) {
-          return weight_bind_ii(dynamic_cast<CatalyticHead *>(base));
-        },
-        [&](Object *base) {
-          exe_bind_ii(dynamic_cast<CatalyticHead *>(base), &motors_,
-                      filaments_);
-        });
+        &motors_.sorted_.at("bind_ii"), poisson, weight_bind_ii,
+        [=](CatalyticHead *head) { exe_bind_ii(head, &motors_, filaments_); });
   }
   // Unbind_II
   auto exe_unbind_ii = [](auto *head, auto *pop, auto *fil) {
     bool executed{head->Unbind()};
     if (executed) {
-      pop->FlagForUpdate();
-      fil->FlagForUpdate();
+      pop->FlagForUpdate(head->parent_);
     }
   };
   auto weight_unbind_ii = [](auto *head) {
     return head->GetWeight_Unbind_II();
   };
-  auto is_doubly_bound = [](Object *protein) -> Vec<Object *> {
-    if (protein->GetNumHeadsActive() == 2) {
-      return {protein->GetHeadOne(), protein->GetHeadTwo()};
+  auto is_doubly_bound = [](Protein *protein,
+                            MemberList<BindingHead> &members) {
+    if (protein->n_heads_active_ == 2) {
+      members.push_back(&protein->head_one_);
+      members.push_back(&protein->head_two_);
     }
-    return {};
   };
   if (xlinks_.crosslinking_active_) {
     xlinks_.AddPop("unbind_ii", is_doubly_bound);
-    kmc_.events_.emplace_back(
+    kmc_.AddEvent<BindingHead>(
         "unbind_ii", xlinks_.p_event_.at("unbind_ii").GetVal(),
-        &xlinks_.sorted_.at("unbind_ii").size_,
-        &xlinks_.sorted_.at("unbind_ii").entries_, poisson,
-        [&](Object *base) {
-          return weight_unbind_ii(dynamic_cast<BindingHead *>(base));
-        },
-        [&](Object *base) {
-          exe_unbind_ii(dynamic_cast<BindingHead *>(base), &xlinks_,
-                        filaments_);
-        });
+        &xlinks_.sorted_.at("unbind_ii"), poisson, weight_unbind_ii,
+        [=](BindingHead *head) { exe_unbind_ii(head, &xlinks_, filaments_); });
   }
   if (motors_.active_) {
-    auto is_ADPP_ii_bound = [](auto *motor) -> Vec<Object *> {
+    auto is_ADPP_ii_bound = [](Motor *motor,
+                               MemberList<CatalyticHead> &members) {
       if (motor->n_heads_active_ == 2) {
         bool found_head{false};
         CatalyticHead *chosen_head{nullptr};
@@ -1581,24 +1420,16 @@ void ProteinManager::InitializeEvents() {
           chosen_head = &motor->head_two_;
         }
         if (chosen_head != nullptr) {
-          return {chosen_head};
+          members.push_back(chosen_head);
         }
       }
-      return {};
     };
-    motors_.AddPop("unbind_ii", [&](Object *base) {
-      return is_ADPP_ii_bound(dynamic_cast<Motor *>(base));
-    });
-    kmc_.events_.emplace_back(
+    motors_.AddPop("unbind_ii", is_ADPP_ii_bound);
+    kmc_.AddEvent<CatalyticHead>(
         "unbind_ii", motors_.p_event_.at("unbind_ii").GetVal(),
-        &motors_.sorted_.at("unbind_ii").size_,
-        &motors_.sorted_.at("unbind_ii").entries_, poisson,
-        [&](Object *base) {
-          return weight_unbind_ii(dynamic_cast<CatalyticHead *>(base));
-        },
-        [&](Object *base) {
-          exe_unbind_ii(dynamic_cast<CatalyticHead *>(base), &motors_,
-                        filaments_);
+        &motors_.sorted_.at("unbind_ii"), poisson, weight_unbind_ii,
+        [=](CatalyticHead *head) {
+          exe_unbind_ii(head, &motors_, filaments_);
         });
   }
   // Unbind_I: Unbind first (singly bound) head of a protein
@@ -1607,48 +1438,35 @@ void ProteinManager::InitializeEvents() {
     if (executed) {
       head->UntetherSatellite();
       pop->RemoveFromActive(head->parent_);
-      fil->FlagForUpdate();
     }
   };
   if (xlinks_.active_) {
-    xlinks_.AddPop("bound_i", is_singly_bound, dim_size, i_min, get_n_neighbs);
+    xlinks_.AddPop("bound_i", is_singly_bound, dim_size, get_n_neighbs);
     for (int n_neighbs{0}; n_neighbs <= _n_neighbs_max; n_neighbs++) {
-      kmc_.events_.emplace_back(
+      kmc_.AddEvent<BindingHead>(
           "unbind_i", xlinks_.p_event_.at("unbind_i").GetVal(n_neighbs),
-          &xlinks_.sorted_.at("bound_i").bin_size_[0][0][n_neighbs],
-          &xlinks_.sorted_.at("bound_i").bin_entries_[0][0][n_neighbs],
-          binomial, [&](Object *base) {
-            exe_unbind_i(dynamic_cast<BindingHead *>(base), &xlinks_,
-                         filaments_);
-          });
+          xlinks_.sorted_.at("bound_i").GetBin(0, 0, n_neighbs),
+          binomial,
+          [=](BindingHead *head) { exe_unbind_i(head, &xlinks_, filaments_); });
     }
   }
   if (motors_.active_) {
     auto weight_unbind_i = [](auto *head) {
       return head->parent_->GetWeight_Unbind_I();
     };
-    auto is_ADPP_i_bound = [](auto *motor) -> Vec<Object *> {
+    auto is_ADPP_i_bound = [](Motor *motor,
+                              MemberList<CatalyticHead> &members) {
       if (motor->n_heads_active_ == 1) {
         if (motor->GetActiveHead()->ligand_ == CatalyticHead::Ligand::ADPP) {
-          return {motor->GetActiveHead()};
+          members.push_back(motor->GetActiveHead());
         }
       }
-      return {};
     };
-    motors_.AddPop("bound_i_ADPP", [&](Object *base) {
-      return is_ADPP_i_bound(dynamic_cast<Motor *>(base));
-    });
-    kmc_.events_.emplace_back(
+    motors_.AddPop("bound_i_ADPP", is_ADPP_i_bound);
+    kmc_.AddEvent<CatalyticHead>(
         "unbind_i", motors_.p_event_.at("unbind_i").GetVal(),
-        &motors_.sorted_.at("bound_i_ADPP").size_,
-        &motors_.sorted_.at("bound_i_ADPP").entries_, poisson,
-        [&](Object *base) {
-          return weight_unbind_i(dynamic_cast<CatalyticHead *>(base));
-        },
-        [&](Object *base) {
-          exe_unbind_i(dynamic_cast<CatalyticHead *>(base), &motors_,
-                       filaments_);
-        });
+        &motors_.sorted_.at("bound_i_ADPP"), poisson, weight_unbind_i,
+        [=](CatalyticHead *head) { exe_unbind_i(head, &motors_, filaments_); });
   }
   // Unbind_I_Teth
   // Tether_Free
@@ -1661,27 +1479,23 @@ void ProteinManager::InitializeEvents() {
       // printf("boop\n");
       bool executed{head->parent_->Bind_ATP(head)};
       if (executed) {
-        pop->FlagForUpdate();
+        pop->FlagForUpdate(head->parent_);
       }
     };
-    auto is_NULL_i_bound = [](auto *motor) -> Vec<Object *> {
+    auto is_NULL_i_bound = [](Motor *motor,
+                              MemberList<CatalyticHead> &members) {
       if (motor->n_heads_active_ == 1) {
         if (motor->GetActiveHead()->ligand_ == CatalyticHead::Ligand::NONE) {
-          return {motor->GetActiveHead()};
+          members.push_back(motor->GetActiveHead());
         }
       }
-      return {};
     };
-    motors_.AddPop("bound_i_NULL", [&](Object *base) {
-      return is_NULL_i_bound(dynamic_cast<Motor *>(base));
-    });
-    kmc_.events_.emplace_back(
+    motors_.AddPop("bound_i_NULL", is_NULL_i_bound);
+    kmc_.AddEvent<CatalyticHead>(
         "bind_ATP_i", motors_.p_event_.at("bind_ATP_i").GetVal(),
         &motors_.sorted_.at("bound_i_NULL").size_,
         &motors_.sorted_.at("bound_i_NULL").entries_, binomial,
-        [&](Object *base) {
-          exe_bind_ATP(dynamic_cast<CatalyticHead *>(base), &motors_);
-        });
+        [=](CatalyticHead *head) { exe_bind_ATP(head, &motors_); });
     auto exe_bind_ATP_ii = [](auto *front_head, auto *pop, auto *fil) {
       auto *rear_head{front_head->GetOtherHead()};
       if (front_head->trailing_) {
@@ -1690,14 +1504,14 @@ void ProteinManager::InitializeEvents() {
       bool unbound{rear_head->Unbind()};
       bool executed{front_head->parent_->Bind_ATP(front_head)};
       if (executed) {
-        pop->FlagForUpdate();
-        fil->FlagForUpdate();
+        pop->FlagForUpdate(front_head->parent_);
       }
     };
     auto weight_bind_ATP_ii = [](auto *head) {
       return head->parent_->GetWeight_BindATP_II(head);
     };
-    auto is_NULL_ii_bound = [](auto *motor) -> Vec<Object *> {
+    auto is_NULL_ii_bound = [](Motor *motor,
+                               MemberList<CatalyticHead> &members) {
       if (motor->n_heads_active_ == 2) {
         bool found_head{false};
         CatalyticHead *chosen_head{nullptr};
@@ -1711,24 +1525,16 @@ void ProteinManager::InitializeEvents() {
           chosen_head = &motor->head_two_;
         }
         if (chosen_head != nullptr) {
-          return {chosen_head};
+          members.push_back(chosen_head);
         }
       }
-      return {};
     };
-    motors_.AddPop("bound_ii_NULL", [&](Object *base) {
-      return is_NULL_ii_bound(dynamic_cast<Motor *>(base));
-    });
-    kmc_.events_.emplace_back(
+    motors_.AddPop("bound_ii_NULL", is_NULL_ii_bound);
+    kmc_.AddEvent<CatalyticHead>(
         "bind_ATP_ii", motors_.p_event_.at("bind_ATP_ii").GetVal(),
-        &motors_.sorted_.at("bound_ii_NULL").size_,
-        &motors_.sorted_.at("bound_ii_NULL").entries_, poisson,
-        [&](Object *base) {
-          return weight_bind_ATP_ii(dynamic_cast<CatalyticHead *>(base));
-        },
-        [&](Object *base) {
-          exe_bind_ATP_ii(dynamic_cast<CatalyticHead *>(base), &motors_,
-                          filaments_);
+        &motors_.sorted_.at("bound_ii_NULL"), poisson, weight_bind_ATP_ii,
+        [=](CatalyticHead *head) {
+          exe_bind_ATP_ii(head, &motors_, filaments_);
         });
   }
   // Hydrolyze_ATP
@@ -1736,27 +1542,22 @@ void ProteinManager::InitializeEvents() {
     auto exe_hydrolyze = [](auto *head, auto *pop) {
       bool executed{head->parent_->Hydrolyze(head)};
       if (executed) {
-        pop->FlagForUpdate();
+        pop->FlagForUpdate(head->parent_);
       }
     };
-    auto is_ATP_i_bound = [](auto *motor) -> Vec<Object *> {
+    auto is_ATP_i_bound = [](Motor *motor, MemberList<CatalyticHead> &members) {
       if (motor->n_heads_active_ == 1) {
         if (motor->GetActiveHead()->ligand_ == CatalyticHead::Ligand::ATP) {
-          return {motor->GetActiveHead()};
+          members.push_back(motor->GetActiveHead());
         }
       }
-      return {};
     };
-    motors_.AddPop("bound_i_ATP", [&](Object *base) {
-      return is_ATP_i_bound(dynamic_cast<Motor *>(base));
-    });
-    kmc_.events_.emplace_back(
+    motors_.AddPop("bound_i_ATP", is_ATP_i_bound);
+    kmc_.AddEvent<CatalyticHead>(
         "hydrolyze", motors_.p_event_.at("hydrolyze").GetVal(),
         &motors_.sorted_.at("bound_i_ATP").size_,
         &motors_.sorted_.at("bound_i_ATP").entries_, binomial,
-        [&](Object *base) {
-          exe_hydrolyze(dynamic_cast<CatalyticHead *>(base), &motors_);
-        });
+        [=](CatalyticHead *head) { exe_hydrolyze(head, &motors_); });
   }
   // Tether_Bound
   // Untether_Bound
@@ -1770,59 +1571,35 @@ void ProteinManager::InitializeEvents() {
       if (!still_attached) {
         // printf("what\n");
       }
-      pop->FlagForUpdate();
-      fil->FlagForUpdate();
+      pop->FlagForUpdate(head->parent_);
     }
   };
+  // Both directions are drawn as one event so a head never steps both ways
+  auto get_dir = [](size_t i_outcome) { return i_outcome == 0 ? 1 : -1; };
   if (xlinks_.active_) {
     for (int n_neighbs{0}; n_neighbs < _n_neighbs_max; n_neighbs++) {
-      kmc_.events_.emplace_back(
-          "diffuse_i_fwd",
-          xlinks_.p_event_.at("diffuse_i_fwd").GetVal(n_neighbs),
-          &xlinks_.sorted_.at("bound_i").bin_size_[0][0][n_neighbs],
-          &xlinks_.sorted_.at("bound_i").bin_entries_[0][0][n_neighbs],
-          binomial, [&](Object *base) {
-            exe_diff(dynamic_cast<BindingHead *>(base), &xlinks_, filaments_,
-                     1);
-          });
-      kmc_.events_.emplace_back(
-          "diffuse_i_bck",
-          xlinks_.p_event_.at("diffuse_i_bck").GetVal(n_neighbs),
-          &xlinks_.sorted_.at("bound_i").bin_size_[0][0][n_neighbs],
-          &xlinks_.sorted_.at("bound_i").bin_entries_[0][0][n_neighbs],
-          binomial, [&](Object *base) {
-            exe_diff(dynamic_cast<BindingHead *>(base), &xlinks_, filaments_,
-                     -1);
+      kmc_.AddFusedEvent<BindingHead>(
+          "diffuse_i",
+          {{"fwd", xlinks_.p_event_.at("diffuse_i_fwd").GetVal(n_neighbs)},
+           {"bck", xlinks_.p_event_.at("diffuse_i_bck").GetVal(n_neighbs)}},
+          xlinks_.sorted_.at("bound_i").GetBin(0, 0, n_neighbs), binomial,
+          [=](BindingHead *head, size_t i_outcome) {
+            exe_diff(head, &xlinks_, filaments_, get_dir(i_outcome));
           });
     }
   }
   if (xlinks_.crosslinking_active_) {
-    auto weight_diff_ii = [](auto *head, int dir) {
-      return head->GetWeight_Diffuse(dir);
-    };
-    xlinks_.AddPop("diffuse_ii_to_rest", is_doubly_bound);
-    xlinks_.AddPop("diffuse_ii_fr_rest", is_doubly_bound);
-    kmc_.events_.emplace_back(
-        "diffuse_ii_to_rest",
-        xlinks_.p_event_.at("diffuse_ii_to_rest").GetVal(),
-        &xlinks_.sorted_.at("diffuse_ii_to_rest").size_,
-        &xlinks_.sorted_.at("diffuse_ii_to_rest").entries_, poisson,
-        [&](Object *base) {
-          return weight_diff_ii(dynamic_cast<BindingHead *>(base), 1);
-        },
-        [&](Object *base) {
-          exe_diff(dynamic_cast<BindingHead *>(base), &xlinks_, filaments_, 1);
-        });
-    kmc_.events_.emplace_back(
-        "diffuse_ii_fr_rest",
-        xlinks_.p_event_.at("diffuse_ii_fr_rest").GetVal(),
-        &xlinks_.sorted_.at("diffuse_ii_fr_rest").size_,
-        &xlinks_.sorted_.at("diffuse_ii_fr_rest").entries_, poisson,
-        [&](Object *base) {
-          return weight_diff_ii(dynamic_cast<BindingHead *>(base), -1);
+    xlinks_.AddPop("diffuse_ii", is_doubly_bound);
+    kmc_.AddFusedEvent<BindingHead>(
+        "diffuse_ii",
+        {{"to_rest", xlinks_.p_event_.at("diffuse_ii_to_rest").GetVal()},
+         {"fr_rest", xlinks_.p_event_.at("diffuse_ii_fr_rest").GetVal()}},
+        &xlinks_.sorted_.at("diffuse_ii"), poisson,
+        [=](BindingHead *head, size_t i_outcome) {
+          return head->GetWeight_Diffuse(get_dir(i_outcome));
         },
-        [&](Object *base) {
-          exe_diff(dynamic_cast<BindingHead *>(base), &xlinks_, filaments_, -1);
+        [=](BindingHead *head, size_t i_outcome) {
+          exe_diff(head, &xlinks_, filaments_, get_dir(i_outcome));
         });
   }
   // Bind_II_Teth
@@ -1836,17 +1613,90 @@ void ProteinManager::InitializeEvents() {
 
 void ProteinManager::FlagFilamentsForUpdate() { filaments_->FlagForUpdate(); }
 
-void ProteinManager::UpdateFilaments() {
-  filaments_->UpdateUnoccupied();
-  if (Sys::test_mode_.empty()) {
+void ProteinManager::FlagForUpdate(BindingSite *site) {
+
+  if (site->occupant_ == nullptr) {
     return;
   }
-  if (Sys::test_mode_ != "filament_ablation") {
+  BindingHead *head{site->occupant_};
+  if (head->GetSpeciesID() == _id_motor) {
+    motors_.FlagForUpdate(static_cast<CatalyticHead *>(head)->parent_);
+  } else if (head->GetSpeciesID() == _id_xlink) {
+    xlinks_.FlagForUpdate(head->parent_);
+  }
+}
+
+void ProteinManager::FlagForUpdate_Bind_II(BindingSite *site) {
+
+  // Bind_II weights of singly-bound xlinks on the neighboring filament depend
+  // on the occupancy (and thus lattice weight) of every site within reach
+  Protofilament *neighb_fil{site->filament_->neighbor_};
+  if (neighb_fil == nullptr) {
+    return;
+  }
+  // Pad by 1 for alignment round-off and 1 for the neighbors of each site
+  double site_size{Params::Filaments::site_size};
+  int delta_max{(int)std::ceil(xlinks_.r_max_ / site_size) + 2};
+  int i_aligned{neighb_fil->GetAlignedIndex(site)};
+  int i_max{int(neighb_fil->sites_.size()) - 1};
+  int i_first{std::max(i_aligned - delta_max, 0)};
+  int i_last{std::min(i_aligned + delta_max, i_max)};
+  if (i_first > i_last) {
+    return;
+  }
+  neighb_fil->ForEachXlinkOccupied(i_first, i_last, [&](BindingSite *neighb) {
+    if (neighb->occupant_->parent_->n_heads_active_ == 1) {
+      xlinks_.FlagForUpdate(neighb->occupant_->parent_);
+    }
+  });
+}
+
+void ProteinManager::UpdateFilaments() {
+  filaments_->UpdateUnoccupied();
+  if (Sys::test_ != Sys::TestMode::FilamentAblation) {
     return;
   }
   if (Sys::i_step_ == Sys::ablation_step_) {
     filaments_->proto_[1].pos_[0] += 200.0;
     filaments_->proto_[1].ForceUpdate();
+    // Deformation no longer spans both filaments; rebuild it from scratch
+    filaments_->FlagForUpdate();
     // printf("HELLO\n");
   }
+  // Cross-filament docking is not captured by neighbor lists; re-sort all
+  if (Sys::i_step_ <= Sys::ablation_step_) {
+    motors_.FlagAllForUpdate();
+  }
+}
+
+void ProteinManager::UpdateReservoirs() {
+
+  // Occupancy changes also affect the populations of any neighboring proteins
+  for (auto &&pf : filaments_->proto_) {
+    for (auto const &site : pf.modified_sites_) {
+      FlagForUpdate(site);
+      for (auto const &neighb : site->GetNeighbors()) {
+        FlagForUpdate(neighb);
+      }
+      if (xlinks_.crosslinking_active_) {
+        FlagForUpdate_Bind_II(site);
+      }
+    }
+    pf.ClearModifiedSites();
+  }
+  motors_.PrepForKMC();
+  xlinks_.PrepForKMC();
+}
+
+void ProteinManager::RunKMC_Continuous() {
+
+  // Execute events one at a time until this timestep has fully elapsed,
+  // refreshing populations after each so that propensities stay exact
+  // If nothing else can happen in the meantime, span several steps at once
+  Sys::n_steps_per_iter_ = Sys::n_steps_skip_max_;
+  kmc_.StartTimestep(Sys::n_steps_per_iter_);
+  while (kmc_.ExecuteNextEvent()) {
+    filaments_->UpdateUnoccupied();
+    UpdateReservoirs();
+  }
 }
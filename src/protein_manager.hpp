@@ -31,7 +31,11 @@ private:
   void InitializeEvents();
 
   void FlagFilamentsForUpdate();
+  void FlagForUpdate(BindingSite *site);
+  void FlagForUpdate_Bind_II(BindingSite *site);
   void UpdateFilaments();
+  void UpdateReservoirs();
+  void RunKMC_Continuous();
 
 public:
   ProteinManager() {}
@@ -49,6 +53,7 @@ public:
   }
   void Initialize(FilamentManager *filaments) {
     filaments_ = filaments;
+    kmc_.Initialize();
     if (!Sys::test_mode_.empty()) {
       InitializeTestEnvironment();
       InitializeTestEvents();
@@ -60,18 +65,29 @@ public:
     InitializeEvents();
   }
   void UpdateLatticeDeformation() { motors_.UpdateLatticeDeformation(); }
+  void ResetLatticeDeformation() { motors_.ResetLatticeDeformation(); }
+  void FlagWeightsForUpdate() {
+    motors_.FlagWeightsForUpdate();
+    xlinks_.FlagWeightsForUpdate();
+  }
   void UpdateExtensions() {
     bool forced_unbind{xlinks_.UpdateExtensions()};
     if (forced_unbind) {
-      xlinks_.FlagForUpdate();
+      xlinks_.FlagAllForUpdate();
       FlagFilamentsForUpdate();
     }
   }
   void RunKMC() {
     UpdateFilaments();
-    motors_.PrepForKMC();
-    xlinks_.PrepForKMC();
-    kmc_.ExecuteEvents();
+    UpdateReservoirs();
+    if (kmc_.continuous_) {
+      RunKMC_Continuous();
+    } else if (Sys::n_steps_skip_max_ > 1) {
+      Sys::n_steps_per_iter_ =
+          kmc_.ExecuteEvents_SkipAhead(Sys::n_steps_skip_max_);
+    } else {
+      kmc_.ExecuteEvents();
+    }
   }
 };
 
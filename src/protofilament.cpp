@@ -40,14 +40,26 @@ void Protofilament::SetParameters() {
   }
 }
 
+void Protofilament::SetTimestep(double dt_kmc) {
+
+  using namespace Params;
+  dt_eff_ = dt_kmc / Filaments::n_bd_per_kmc;
+  for (int i_dim{0}; i_dim < sigma_.size(); i_dim++) {
+    sigma_[i_dim] = sqrt(2 * kbT * dt_eff_ / gamma_[i_dim]); // nm or rad
+  }
+}
+
 void Protofilament::GenerateSites() {
 
   size_t n_sites{Params::Filaments::n_sites[index_]};
   sites_.resize(n_sites);
+  store_.Resize(n_sites);
+  occupied_.resize((n_sites + 63) / 64);
+  occupied_motor_.resize((n_sites + 63) / 64);
   // Initialize sites
   for (int i_entry{0}; i_entry < n_sites; i_entry++) {
     sites_[i_entry].Initialize(_id_site, Sys::n_unique_objects_++, _r_site,
-                               i_entry, this);
+                               i_entry, this, &store_);
   }
   // Set site neighbors (immediately forward/behind; 2 max on a 1-D lattice)
   for (auto &&site : sites_) {
@@ -77,10 +89,9 @@ void Protofilament::UpdateRodPosition() {
 
   // First row is a unit vector (in lab frame) along length of rod
   // Second row is a unit vector (in lab frame) perpendicular to length of rod
-  Vec2D<double> rod_basis{GetOrthonormalBasis(orientation_)};
+  Mat2 rod_basis{GetOrthonormalBasis(orientation_)};
   /* c.f. Tao et al., J. Chem. Phys. (2005); doi.org/10.1063/1.1940031 */
-  Vec2D<double> xi_inv(_n_dims_max, Vec<double>(_n_dims_max, 0.0));
-  // double xi_inv[_n_dims_max][_n_dims_max];
+  Mat2 xi_inv{};
   for (int i{0}; i < _n_dims_max; i++) {
     for (int j{i}; j < _n_dims_max; j++) {
       double uiuj{orientation_[i] * orientation_[j]};
@@ -92,7 +103,7 @@ void Protofilament::UpdateRodPosition() {
   }
   // Apply translationl and rotational displacements
   /*
-  Vec<double> torque_proj{Cross(torque_, orientation_)};
+  Vec2 torque_proj{Cross(torque_, orientation_)};
   double u_norm{0.0};
   */
   for (int i_dim{0}; i_dim < _n_dims_max; i_dim++) {
@@ -127,57 +138,20 @@ void Protofilament::UpdateRodPosition() {
   */
 }
 
-void Protofilament::UpdateSitePositions() {
-
-  // /*
-  // If proteins are disabled, only update endpoint positions
-  if (Params::Filaments::count == 1) {
-    for (int i_dim{0}; i_dim < _n_dims_max; i_dim++) {
-      // Distance will be negative for first half of sites
-      double p_dist{double(plus_end_->index_) - center_index_};
-      p_dist *= Params::Filaments::site_size; // convert to nm
-      // Orientation always points towards increasing site index
-      plus_end_->pos_[i_dim] = pos_[i_dim] + p_dist * Dot(orientation_, i_dim);
-      // Distance will be negative for first half of sites
-      double m_dist{double(minus_end_->index_) - center_index_};
-      m_dist *= Params::Filaments::site_size; // convert to nm
-      // Orientation always points towards increasing site index
-      minus_end_->pos_[i_dim] = pos_[i_dim] + m_dist * Dot(orientation_, i_dim);
-    }
-    return;
-  }
+int Protofilament::GetAlignedIndex(BindingSite *site) {
 
-  for (auto &&site : sites_) {
-    for (int i_dim{0}; i_dim < _n_dims_max; i_dim++) {
-      // Distance will be negative for first half of sites
-      double dist{double(site.index_) - center_index_};
-      dist *= Params::Filaments::site_size; // convert to nm
-      // Orientation always points towards increasing site index
-      site.pos_[i_dim] = pos_[i_dim] + dist * Dot(orientation_, i_dim);
-    }
-  }
-  /*
-  printf("pos[0] = %g\n", pos_[0]);
-  printf("plus: (%g, %g)\n", plus_end_->pos_[0], plus_end_->pos_[1]);
-  printf("minus: (%g, %g)\n", minus_end_->pos_[0], minus_end_->pos_[1]);
-  */
-  /*
-  Sys::Log("%zu & %zu\n", plus_end_->pos_.size(), minus_end_->pos_.size());
-  Sys::Log("plus-end: (%g, %g)\n", plus_end_->pos_[0], plus_end_->pos_[1]);
-  Sys::Log("minus_end: (%g, %g)\n", minus_end_->pos_[0], minus_end_->pos_[1]);
-  */
+  using namespace Params;
+  // Find which site best aligns vertically w/ given site
+  int site_x{(int)site->GetPosition()[0]};
+  // x-coords equal, so site_pos_x = (i_align - center_index) * site_size + pos
+  return int((site_x - pos_[0]) / Filaments::site_size + center_index_);
 }
 
 BindingSite *Protofilament::GetNeighb(BindingSite *site, int delta) {
 
-  using namespace Params;
   // printf("i_site = %i, delta = %i\n", site->index_, delta);
-  // First, we find which site best aligns vertically w/ given site
-  int site_x{(int)site->pos_[0]};
-  // x-coords equal, so site_pos_x = (i_align - center_index) * site_size + pos
-  int i_aligned{int((site_x - pos_[0]) / Filaments::site_size + center_index_)};
   // Scan relative to aligned site using given delta value
-  int i_neighb{i_aligned + delta};
+  int i_neighb{GetAlignedIndex(site) + delta};
   // printf("i_neighb is %i\n", i_neighb);
   if (i_neighb < 0 or i_neighb > sites_.size() - 1) {
     return nullptr;
@@ -18,6 +18,13 @@ public:
 
   int dx_{0}; // Towards plus end
   Vec<BindingSite> sites_;
+  SiteStore store_; // Bulk site state; see BindingSite
+  Vec<BindingSite *> modified_sites_; // Sites w/ new occupancy since last step
+
+  // Packed occupancy; bit (i_site % 64) of word (i_site / 64) is set if the
+  // site is occupied (by any species, or only by motors, respectively)
+  Vec<uint64_t> occupied_;
+  Vec<uint64_t> occupied_motor_;
 
   BindingSite *plus_end_{nullptr};
   BindingSite *minus_end_{nullptr};
@@ -28,7 +35,6 @@ private:
   void GenerateSites();
 
   void UpdateRodPosition();
-  void UpdateSitePositions();
 
 public:
   Protofilament() {}
@@ -37,14 +43,85 @@ public:
     index_ = index;
     SetParameters();
     GenerateSites();
-    UpdateSitePositions();
   }
+  void SetTimestep(double dt_kmc);
+  // Sites are rigidly attached to the rod, so positions are never stored
+  Vec2 GetSitePosition(size_t i_site) {
+    // Distance will be negative for first half of sites
+    double dist{double(i_site) - center_index_};
+    dist *= Params::Filaments::site_size; // convert to nm
+    // Orientation always points towards increasing site index
+    Vec2 pos;
+    for (int i_dim{0}; i_dim < _n_dims_max; i_dim++) {
+      pos[i_dim] = pos_[i_dim] + dist * Dot(orientation_, i_dim);
+    }
+    return pos;
+  }
+  int GetAlignedIndex(BindingSite *site);
   BindingSite *GetNeighb(BindingSite *site, int delta);
-  Vec<double> GetPolarOrientation() {
+  void FlagForUpdate(BindingSite *site) {
+    if (site->modified_) {
+      return;
+    }
+    site->modified_ = true;
+    modified_sites_.push_back(site);
+  }
+  void SetOccupied(size_t i_site, bool motor) {
+    uint64_t bit{uint64_t(1) << (i_site % 64)};
+    occupied_[i_site / 64] |= bit;
+    if (motor) {
+      occupied_motor_[i_site / 64] |= bit;
+    }
+  }
+  void SetUnoccupied(size_t i_site) {
+    uint64_t bit{uint64_t(1) << (i_site % 64)};
+    occupied_[i_site / 64] &= ~bit;
+    occupied_motor_[i_site / 64] &= ~bit;
+  }
+  // Calls fn(site) on each site in [i_first, i_last] (in order) whose bit is
+  // set in get_word(i_word); visits 64 sites per word w/o touching any others
+  template <typename WORD_FN, typename SITE_FN>
+  void ForEachSite(size_t i_first, size_t i_last, WORD_FN get_word,
+                   SITE_FN fn) {
+    for (size_t i_word{i_first / 64}; i_word <= i_last / 64; i_word++) {
+      uint64_t word{get_word(i_word)};
+      if (i_word == i_first / 64) {
+        word &= ~uint64_t(0) << (i_first % 64);
+      }
+      if (i_word == i_last / 64 and i_last % 64 != 63) {
+        word &= (uint64_t(1) << (i_last % 64 + 1)) - 1;
+      }
+      while (word != 0) {
+        fn(&sites_[i_word * 64 + __builtin_ctzll(word)]);
+        word &= word - 1;
+      }
+    }
+  }
+  template <typename SITE_FN>
+  void ForEachUnoccupied(size_t i_first, size_t i_last, SITE_FN fn) {
+    ForEachSite(i_first, i_last, [&](size_t i) { return ~occupied_[i]; }, fn);
+  }
+  template <typename SITE_FN> void ForEachOccupied(SITE_FN fn) {
+    ForEachSite(0, sites_.size() - 1,
+                [&](size_t i) { return occupied_[i]; }, fn);
+  }
+  template <typename SITE_FN>
+  void ForEachXlinkOccupied(size_t i_first, size_t i_last, SITE_FN fn) {
+    ForEachSite(i_first, i_last,
+                [&](size_t i) { return occupied_[i] & ~occupied_motor_[i]; },
+                fn);
+  }
+  void ClearModifiedSites() {
+    for (auto const &site : modified_sites_) {
+      site->modified_ = false;
+    }
+    modified_sites_.clear();
+  }
+  Vec2 GetPolarOrientation() {
     double c{polarity_ == 0 ? -1.0 : 1.0};
     return {c * orientation_[0], c * orientation_[1]};
   }
-  void AddForce(BindingSite *location, Vec<double> f_applied) {
+  void AddForce(BindingSite *location, Vec2 const &f_applied) {
     if (Sys::i_step_ < immobile_until_) {
       return;
     }
@@ -54,9 +131,9 @@ public:
     }
     /*
     if (Params::Filaments::rotation_enabled) {
-      Vec<double> r(_n_dims_max, 0.0); // Points from rod COM to site COM
+      Vec2 r{}; // Points from rod COM to site COM
       for (int i_dim{0}; i_dim < _n_dims_max; i_dim++) {
-        r[i_dim] = location->pos_[i_dim] - pos_[i_dim];
+        r[i_dim] = location->GetPosition()[i_dim] - pos_[i_dim];
       }
       torque_ += Cross(r, f_applied);
     }
@@ -75,11 +152,7 @@ public:
       return;
     }
     UpdateRodPosition();
-    UpdateSitePositions();
-  }
-  void ForceUpdate() {
-    UpdateRodPosition();
-    UpdateSitePositions();
   }
+  void ForceUpdate() { UpdateRodPosition(); }
 };
 #endif
\ No newline at end of file
@@ -8,16 +8,25 @@ template class Reservoir<Protein>;
 template <typename ENTRY_T>
 void Reservoir<ENTRY_T>::GenerateEntries(size_t n_entries) {
 
-  reservoir_.resize(n_entries);
+  // Only the first entry is generated up front; see GetFreeEntry()
+  n_entries_max_ = n_entries;
   active_entries_.resize(n_entries);
-  for (int i_entry{0}; i_entry < n_entries; i_entry++) {
-    reservoir_[i_entry].Initialize(species_id_, Sys::n_unique_objects_++);
-  }
+  free_entries_.reserve(n_entries);
+  GenerateEntry();
   r_min_ = reservoir_[0].spring_.r_min_;
   r_rest_ = reservoir_[0].spring_.r_rest_;
   r_max_ = reservoir_[0].spring_.r_max_;
 }
 
+template <typename ENTRY_T> void Reservoir<ENTRY_T>::GenerateEntry() {
+
+  ENTRY_T *entry{&reservoir_.emplace_back()};
+  entry->Initialize(species_id_, Sys::n_unique_objects_++);
+  entry->pool_index_ = reservoir_.size() - 1;
+  flagged_.push_back(false);
+  free_entries_.push_back(entry);
+}
+
 template <typename ENTRY_T> void Reservoir<ENTRY_T>::SetParameters() {
 
   using namespace Params;
@@ -86,23 +95,39 @@ template <typename ENTRY_T> void Reservoir<ENTRY_T>::CheckEquilibration() {
 
 template <typename ENTRY_T> void Reservoir<ENTRY_T>::SortPopulations() {
 
-  // if (up_to_date_) {
-  //   printf("UP TO DATE!!\n");
-  //   return;
-  // }
-  // up_to_date_ = true;
-  // printf("%i ACTIVE\n", n_active_entries_);
-  for (auto &&pop : sorted_) {
-    pop.second.ZeroOut();
+  // Full re-sort is only needed on startup or when explicitly requested
+  if (!up_to_date_) {
+    up_to_date_ = true;
+    for (auto &&pop : sorted_) {
+      pop.second.ZeroOut();
+    }
+    for (auto const &entry : flagged_entries_) {
+      flagged_[entry->pool_index_] = false;
+    }
+    flagged_entries_.clear();
+    for (int i_entry{0}; i_entry < n_active_entries_; i_entry++) {
+      ENTRY_T *entry{active_entries_[i_entry]};
+      Sys::Log(1, " entry no %i (ID %i)\n", i_entry, entry->GetID());
+      for (auto &&pop : sorted_) {
+        Sys::Log(1, "  sorting into %s\n", pop.second.name_.c_str());
+        pop.second.Update(entry);
+      }
+    }
+    return;
+  }
+  // Weights of bound proteins are otherwise only re-evaluated when flagged
+  // (see ProteinManager::UpdateReservoirs()), but tether extensions depend on
+  // the positions of satellites, which are not tracked; always re-evaluate
+  if (tethering_active_) {
+    FlagWeightsForUpdate();
   }
-  for (int i_entry{0}; i_entry < n_active_entries_; i_entry++) {
-    ENTRY_T *entry{active_entries_[i_entry]};
-    Sys::Log(1, " entry no %i (ID %i)\n", i_entry, entry->GetID());
-    // printf(" %i HEADS\n", entry->GetNumHeadsActive());
-    // entry->UpdateExtension();
+  // Otherwise, only re-sort entries that have changed since the last step
+  for (auto const &entry : flagged_entries_) {
+    flagged_[entry->pool_index_] = false;
+    Sys::Log(1, " updating entry ID %i\n", entry->GetID());
     for (auto &&pop : sorted_) {
-      Sys::Log(1, "  sorting into %s\n", pop.second.name_.c_str());
-      pop.second.Sort(entry);
+      pop.second.Update(entry);
     }
   }
+  flagged_entries_.clear();
 }
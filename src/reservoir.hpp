@@ -1,6 +1,7 @@
 #ifndef _CYLAKS_RESERVOIR_HPP_
 #define _CYLAKS_RESERVOIR_HPP_
 #include "population.hpp"
+#include <deque>
 #include "system_namespace.hpp"
 #include "system_parameters.hpp"
 #include "system_rng.hpp"
@@ -8,11 +9,18 @@
 class Object;
 
 template <typename ENTRY_T> struct Reservoir {
+public:
+  using HEAD_T = decltype(ENTRY_T::head_one_); // e.g., CatalyticHead for Motor
+
 private:
   size_t species_id_;
-  Vec<ENTRY_T> reservoir_;
+  size_t n_entries_max_{0};       // Pool never grows beyond this size
+  std::deque<ENTRY_T> reservoir_; // Grows on demand; entries never move
+  Vec<ENTRY_T *> free_entries_;   // Unbound entries; last one is handed out
 
   bool up_to_date_{false};
+  Vec<bool> flagged_;               // Whether entry needs to be re-sorted
+  Vec<ENTRY_T *> flagged_entries_; // Entries that changed since last sort
 
   double n_bound_avg_{0.0};
   double n_bound_var_{0.0};
@@ -65,10 +73,11 @@ public:
 
   Map<Str, ProbEntry> p_event_;
   Map<Str, BoltzmannFactor> weights_;
-  Map<Str, Population<Object>> sorted_;
+  Map<Str, Population<ENTRY_T, HEAD_T>> sorted_;
 
 private:
   void GenerateEntries(size_t n_entries);
+  void GenerateEntry();
   void SetParameters();
   void CheckEquilibration();
   void SortPopulations();
@@ -104,48 +113,60 @@ public:
   void AddProb(Str name, Vec3D<double> vals) {
     p_event_.emplace(name, ProbEntry(name, vals));
   }
-  void AddPop(Str name, Fn<Vec<Object *>(Object *)> sort) {
-    sorted_.emplace(name, Population<Object>(name, sort, reservoir_.size()));
+  void AddPop(Str name, Fn<void(ENTRY_T *, MemberList<HEAD_T> &)> sort) {
+    sorted_.emplace(name, Population<ENTRY_T, HEAD_T>(name, sort,
+                                                      n_entries_max_));
   }
-  void AddPop(Str name, Fn<Vec<Object *>(Object *)> sort, Vec<size_t> dimsize,
-              Vec<int> i_min, Fn<Vec<int>(Object *)> get_i) {
-    Vec<size_t> sz{dimsize[0], dimsize[1], dimsize[2], reservoir_.size()};
-    sorted_.emplace(name, Population<Object>(name, sort, sz, i_min, get_i));
+  void AddPop(Str name, Fn<void(ENTRY_T *, MemberList<HEAD_T> &)> sort,
+              Vec<size_t> dimsize, Fn<void(HEAD_T *, BinIndices &)> get_i) {
+    Vec<size_t> sz{dimsize[0], dimsize[1], dimsize[2], n_entries_max_};
+    sorted_.emplace(name, Population<ENTRY_T, HEAD_T>(name, sort, sz, get_i));
   }
+  // Entry remains free (and will be returned again) until AddToActive()
   ENTRY_T *GetFreeEntry() {
-    size_t i_entry = SysRNG::GetRanInt(reservoir_.size());
-    ENTRY_T *entry = &reservoir_[i_entry];
-    size_t n_attempts{0};
-    while (entry->n_heads_active_ > 0 or entry->tethered_) {
-      if (n_attempts > reservoir_.size()) {
+    if (free_entries_.empty()) {
+      if (reservoir_.size() == n_entries_max_) {
         return nullptr;
       }
-      i_entry++;
-      if (i_entry == reservoir_.size()) {
-        i_entry = 0;
-      }
-      entry = &reservoir_[i_entry];
-      n_attempts++;
+      GenerateEntry();
     }
-    return entry;
+    return free_entries_.back();
   }
   void AddToActive(ENTRY_T *entry) {
+    if (free_entries_.empty() or free_entries_.back() != entry) {
+      Sys::ErrorExit("Reservoir::AddToActive()");
+    }
+    free_entries_.pop_back();
     entry->active_index_ = n_active_entries_;
     active_entries_[n_active_entries_++] = entry;
-    FlagForUpdate();
+    FlagForUpdate(entry);
   }
   void RemoveFromActive(ENTRY_T *entry) {
     size_t i_entry{entry->active_index_};
     active_entries_[i_entry] = active_entries_[--n_active_entries_];
     active_entries_[i_entry]->active_index_ = i_entry;
-    FlagForUpdate();
+    free_entries_.push_back(entry);
+    FlagForUpdate(entry);
   }
+  // Only entries that changed since the last step can have moved
   void UpdateLatticeDeformation() {
     if (!lattice_coop_active_) {
       return;
     }
+    for (auto const &entry : flagged_entries_) {
+      entry->UpdateLatticeDeformation();
+    }
+  }
+  // Assumes the deformation of every site has been zeroed out beforehand
+  void ResetLatticeDeformation() {
+    if (!lattice_coop_active_) {
+      return;
+    }
+    for (auto &&entry : reservoir_) {
+      entry.ClearLatticeDeformation();
+    }
     for (int i_entry{0}; i_entry < n_active_entries_; i_entry++) {
-      active_entries_[i_entry]->ApplyLatticeDeformation();
+      active_entries_[i_entry]->UpdateLatticeDeformation();
     }
   }
   bool UpdateExtensions() {
@@ -158,7 +179,20 @@ public:
     }
     return force_unbind_occurred;
   }
-  void FlagForUpdate() { up_to_date_ = false; }
+  void FlagForUpdate(ENTRY_T *entry) {
+    size_t i_entry{entry->pool_index_};
+    if (flagged_[i_entry]) {
+      return;
+    }
+    flagged_[i_entry] = true;
+    flagged_entries_.push_back(entry);
+  }
+  void FlagAllForUpdate() { up_to_date_ = false; }
+  void FlagWeightsForUpdate() {
+    for (auto &&pop : sorted_) {
+      pop.second.FlagWeightsForUpdate();
+    }
+  }
   void PrepForKMC() {
     if (Sys::i_step_ < step_active_) {
       return;
@@ -11,15 +11,13 @@ public:
   Vec<double> sigma_;  // Indicies: 0->par, 1->perp, 2->rot
 
   double torque_{0.0};
-  Vec<double> force_;       // In pN; zero'd out every timestep
-  Vec<double> orientation_; // Unit vector
+  Vec2 force_{};       // In pN; zero'd out every timestep
+  Vec2 orientation_{}; // Unit vector
 
 private:
   void SetParameters() {
     gamma_.resize(3);
     sigma_.resize(3);
-    force_.resize(_n_dims_max);
-    orientation_.resize(_n_dims_max);
   }
 
 public:
@@ -0,0 +1,71 @@
+#ifndef _CYLAKS_SCRATCH_ARENA_HPP_
+#define _CYLAKS_SCRATCH_ARENA_HPP_
+#include "definitions.hpp"
+#include <type_traits>
+
+// Bump allocator for short-lived arrays, e.g., those only needed within a
+// single KMC-BD iteration; all memory is reclaimed at once via Reset()
+class ScratchArena {
+private:
+  struct Block {
+    UPtr<char[]> data_;
+    size_t size_{0};
+  };
+  Vec<Block> blocks_;
+  size_t i_block_{0};      // Block currently being allocated from
+  size_t offset_{0};       // # of bytes in use within current block
+  size_t n_bytes_used_{0}; // # of bytes handed out since last Reset()
+  size_t n_bytes_peak_{0}; // High-water mark of n_bytes_used_
+  size_t n_bytes_block_min_{size_t(1) << 16};
+
+private:
+  size_t GetCapacity() {
+    size_t capacity{0};
+    for (auto const &block : blocks_) {
+      capacity += block.size_;
+    }
+    return capacity;
+  }
+  void AddBlock(size_t n_bytes) {
+    n_bytes = std::max({n_bytes, n_bytes_block_min_, GetCapacity()});
+    blocks_.push_back({UPtr<char[]>(new char[n_bytes]), n_bytes});
+  }
+
+public:
+  ScratchArena() {}
+  // Returns an uninitialized array; valid until the next call to Reset()
+  template <typename DATA_T> DATA_T *Allocate(size_t count) {
+    static_assert(std::is_trivially_destructible_v<DATA_T>);
+    size_t n_bytes{count * sizeof(DATA_T)};
+    size_t align{alignof(DATA_T)};
+    while (true) {
+      if (i_block_ == blocks_.size()) {
+        AddBlock(n_bytes + align);
+      }
+      size_t i_start{(offset_ + align - 1) / align * align};
+      if (i_start + n_bytes <= blocks_[i_block_].size_) {
+        offset_ = i_start + n_bytes;
+        n_bytes_used_ += n_bytes;
+        n_bytes_peak_ = std::max(n_bytes_peak_, n_bytes_used_);
+        DATA_T *array{(DATA_T *)&blocks_[i_block_].data_[i_start]};
+        std::uninitialized_default_construct_n(array, count);
+        return array;
+      }
+      i_block_++;
+      offset_ = 0;
+    }
+  }
+  void Reset() {
+    // Merge blocks so that subsequent iterations fit in a single one
+    if (blocks_.size() > 1) {
+      size_t capacity{GetCapacity()};
+      blocks_.clear();
+      AddBlock(capacity);
+    }
+    i_block_ = 0;
+    offset_ = 0;
+    n_bytes_used_ = 0;
+  }
+  size_t GetPeakUsage() { return n_bytes_peak_; }
+};
+#endif
@@ -0,0 +1,101 @@
+#ifndef _CYLAKS_SUM_TREE_HPP_
+#define _CYLAKS_SUM_TREE_HPP_
+#include "definitions.hpp"
+
+// Binary tree of partial sums over a list of weights; allows O(log n) updates
+// and weighted selection, while the total weight is always available in O(1)
+struct SumTree {
+private:
+  size_t capacity_{1};  // Number of leaves; always a power of 2
+  Vec<double> nodes_{}; // [1] is root; children of [i] are [2i] and [2i + 1]
+
+public:
+  size_t size_{0};      // Number of leaves currently in use
+  size_t n_nonzero_{0}; // Number of leaves w/ non-zero weight
+
+private:
+  void Reserve(size_t size) {
+    if (size <= capacity_ and !nodes_.empty()) {
+      return;
+    }
+    size_t new_capacity{capacity_};
+    while (new_capacity < size) {
+      new_capacity *= 2;
+    }
+    Vec<double> leaves(size_, 0.0);
+    for (size_t i_leaf{0}; i_leaf < size_; i_leaf++) {
+      leaves[i_leaf] = Get(i_leaf);
+    }
+    capacity_ = new_capacity;
+    nodes_.assign(2 * capacity_, 0.0);
+    for (size_t i_leaf{0}; i_leaf < size_; i_leaf++) {
+      nodes_[capacity_ + i_leaf] = leaves[i_leaf];
+    }
+    for (size_t i_node{capacity_ - 1}; i_node > 0; i_node--) {
+      nodes_[i_node] = nodes_[2 * i_node] + nodes_[2 * i_node + 1];
+    }
+  }
+
+public:
+  SumTree() {}
+  double GetTotal() { return nodes_.empty() ? 0.0 : nodes_[1]; }
+  double Get(size_t i_leaf) { return nodes_[capacity_ + i_leaf]; }
+  // Not tracked by the tree itself, so this is O(n); use sparingly
+  double GetMax() {
+    double max{0.0};
+    for (size_t i_leaf{0}; i_leaf < size_; i_leaf++) {
+      max = std::max(max, Get(i_leaf));
+    }
+    return max;
+  }
+  void Set(size_t i_leaf, double weight) {
+    size_t i_node{capacity_ + i_leaf};
+    if (nodes_[i_node] == 0.0 and weight != 0.0) {
+      n_nonzero_++;
+    } else if (nodes_[i_node] != 0.0 and weight == 0.0) {
+      n_nonzero_--;
+    }
+    nodes_[i_node] = weight;
+    // Parents are re-summed from their children so no round-off accumulates
+    for (i_node /= 2; i_node > 0; i_node /= 2) {
+      nodes_[i_node] = nodes_[2 * i_node] + nodes_[2 * i_node + 1];
+    }
+  }
+  // Sets every leaf in use at once; parents are summed in a single O(n) pass
+  template <typename WEIGHT_FN> void SetAll(WEIGHT_FN get_weight) {
+    n_nonzero_ = 0;
+    for (size_t i_leaf{0}; i_leaf < size_; i_leaf++) {
+      double weight{get_weight(i_leaf)};
+      nodes_[capacity_ + i_leaf] = weight;
+      if (weight != 0.0) {
+        n_nonzero_++;
+      }
+    }
+    for (size_t i_node{capacity_ - 1}; i_node > 0; i_node--) {
+      nodes_[i_node] = nodes_[2 * i_node] + nodes_[2 * i_node + 1];
+    }
+  }
+  // Leaves beyond the new size are zeroed so that they are never selected
+  void Resize(size_t size) {
+    Reserve(size);
+    for (size_t i_leaf{size}; i_leaf < size_; i_leaf++) {
+      Set(i_leaf, 0.0);
+    }
+    size_ = size;
+  }
+  // Returns index of leaf whose cumulative weight range contains val
+  size_t Find(double val) {
+    size_t i_node{1};
+    while (i_node < capacity_) {
+      double left{nodes_[2 * i_node]};
+      if (val < left or nodes_[2 * i_node + 1] == 0.0) {
+        i_node = 2 * i_node;
+      } else {
+        val -= left;
+        i_node = 2 * i_node + 1;
+      }
+    }
+    return i_node - capacity_;
+  }
+};
+#endif
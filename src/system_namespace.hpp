@@ -1,5 +1,6 @@
 #ifndef _CYLAKS_SYSTEM_NAMESPACE_HPP_
 #define _CYLAKS_SYSTEM_NAMESPACE_HPP_
+#include "scratch_arena.hpp"
 #include <cstring>
 #include <filesystem>
 
@@ -9,6 +10,20 @@ namespace Sys {
 
 inline std::string sim_name_;
 inline std::string test_mode_;
+// Resolved from test_mode_ once at startup so that hot paths need not compare
+// strings; None for production runs
+enum class TestMode {
+  None,
+  XlinkBindII,
+  XlinkDiffusion,
+  MotorLatticeBind,
+  MotorLatticeStep,
+  FilamentSeparation,
+  FilamentAblation,
+  HeteroTubulin,
+  KinesinMutant
+};
+inline TestMode test_{TestMode::None};
 inline std::string yaml_file_;
 
 inline int n_xlinks_{-1};
@@ -34,12 +49,17 @@ inline size_t n_steps_equil_{0};
 inline size_t n_steps_run_{0};
 
 inline size_t i_step_{0};
+inline size_t n_steps_per_iter_{1}; // # of dt each KMC-BD iteration spans
+inline size_t n_steps_skip_max_{1}; // Max # of dt if idle steps are skipped
 inline size_t i_datapoint_{0};
 
+inline ScratchArena scratch_; // Per-iteration arrays; reset by Curator
+
 inline std::vector<double> weight_neighb_bind_;   // [n_neighbs]
 inline std::vector<double> weight_neighb_unbind_; // [n_neighbs]
 
 inline size_t lattice_cutoff_;
+inline std::vector<double> energy_lattice_;            // [delta]; in kbT
 inline std::vector<double> weight_lattice_bind_;       // [delta]
 inline std::vector<double> weight_lattice_unbind_;     // [delta]
 inline std::vector<double> weight_lattice_bind_max_;   // [n_neighbs]
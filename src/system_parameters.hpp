@@ -1,5 +1,6 @@
 #ifndef _CYLAKS_SYSTEM_PARAMETERS_HPP_
 #define _CYLAKS_SYSTEM_PARAMETERS_HPP_
+#include <string>
 #include <vector>
 
 namespace Params {
@@ -12,6 +13,11 @@ inline double t_equil;
 inline double t_snapshot;
 inline double dynamic_equil_window; // Set to 0 or negative value to disable
 inline size_t verbosity;
+inline std::string kmc_engine; // "leaping" (fixed-dt) or "continuous" (BKL)
+inline double dt_max;            // Adaptive dt is enabled if dt_max > dt; s
+inline double p_step_max;        // Adaptive dt/multi-rate; max. p per entry
+inline double conflict_frac_max; // Adaptive dt; max. fraction of conflicts
+inline size_t n_steps_per_sample_max; // Multi-rate KMC; 1 to disable
 namespace Filaments {
 inline size_t count;                  // Number of filaments to simulate
 inline double radius;                 // Radius of rod (or barrel for MTs); nm
@@ -1,46 +1,176 @@
 #ifndef _CYLAKS_SYSTEM_RNG_HPP_
 #define _CYLAKS_SYSTEM_RNG_HPP_
+#include "definitions.hpp"
+#include "philox.hpp"
 #include <gsl/gsl_randist.h>
 #include <gsl/gsl_rng.h>
+#include <new>
 
 struct SysRNG {
+public:
+  // Each subsystem draws from its own stream, so that its sequence of random
+  // numbers does not depend on how many the others have used
+  enum Stream {
+    Kinetics,  // Event statistics and KMC timing
+    Selection, // Choice of event targets and conflict resolution
+    Proteins,  // Choices made by proteins, e.g., direction of diffusion
+    Noise,     // Brownian dynamics
+    n_streams
+  };
+
+private:
+  // Philox is wrapped as a GSL generator so that GSL's samplers can use it
+  static void SetState(void *state, unsigned long seed) {
+    new (state) Philox();
+    static_cast<Philox *>(state)->Seed(seed, 0);
+  }
+  static unsigned long GetState(void *state) {
+    return static_cast<Philox *>(state)->GetUInt();
+  }
+  static double GetState_Double(void *state) {
+    return static_cast<Philox *>(state)->GetUniform();
+  }
+  inline static const gsl_rng_type generator_type_{
+      "philox4x32-10", 0xffffffffUL, 0,  sizeof(Philox),
+      &SetState,       &GetState,    &GetState_Double};
+  inline static gsl_rng *streams_[n_streams];
+  inline static Vec<bool> chosen_; // Scratch membership flags for SetRanIndices
+  // Small-mean samplers invert the CDF directly using pre-generated uniforms;
+  // above n_avg_inversion_max_, GSL's general-purpose algorithms are used
+  inline static double n_avg_inversion_max_{10.0};
+  inline static size_t n_uniforms_per_block_{1024};
+  inline static Vec<double> uniforms_;
+  inline static size_t i_uniform_{0};
+
 private:
-  inline static const gsl_rng_type *generator_type_{gsl_rng_mt19937};
-  inline static gsl_rng *rng_;
+  static Philox *GetPhilox(Stream stream) {
+    return static_cast<Philox *>(streams_[stream]->state);
+  }
+  static double GetUniform() {
+    if (i_uniform_ == uniforms_.size()) {
+      GetPhilox(Kinetics)->FillUniform(uniforms_.data(), uniforms_.size());
+      i_uniform_ = 0;
+    }
+    return uniforms_[i_uniform_++];
+  }
 
 public:
   SysRNG() {}
-  ~SysRNG() { gsl_rng_free(rng_); }
-  static void Initialize(int seed) {
-    rng_ = gsl_rng_alloc(generator_type_);
-    gsl_rng_set(rng_, seed);
+  ~SysRNG() {
+    for (auto &rng : streams_) {
+      gsl_rng_free(rng);
+    }
+  }
+  static void Initialize(size_t seed) {
+    for (int i_stream{0}; i_stream < n_streams; i_stream++) {
+      streams_[i_stream] = gsl_rng_alloc(&generator_type_);
+      GetPhilox(Stream(i_stream))->Seed(seed, i_stream);
+    }
+    uniforms_.resize(n_uniforms_per_block_);
+    i_uniform_ = uniforms_.size();
   }
   // NOTE: These functions could be wrapped to simply return 0 if
   // given 0 as an input, but this can mask more fundamental errors
   // in the simulation, so the seg-faults from GSL should be observed
   static int SampleBinomial(double p, int n) {
-    return gsl_ran_binomial(rng_, p, n);
+    if (n * p > n_avg_inversion_max_) {
+      return gsl_ran_binomial(streams_[Kinetics], p, n);
+    }
+    double ran{GetUniform()};
+    double p_k{std::exp(n * std::log1p(-p))};
+    double odds{p / (1.0 - p)};
+    int k{0};
+    while (ran > p_k and k < n) {
+      ran -= p_k;
+      p_k *= double(n - k) / (k + 1) * odds;
+      k++;
+    }
+    return k;
   }
   static int SamplePoisson(double n_avg) {
-    return gsl_ran_poisson(rng_, n_avg);
+    if (n_avg > n_avg_inversion_max_) {
+      return gsl_ran_poisson(streams_[Kinetics], n_avg);
+    }
+    double ran{GetUniform()};
+    double p_k{std::exp(-n_avg)};
+    int k{0};
+    while (ran > p_k and p_k > 0.0) {
+      ran -= p_k;
+      p_k *= n_avg / (k + 1);
+      k++;
+    }
+    return k;
+  }
+  // Conditioned on a non-zero result; zero must not be a certainty (p, n > 0)
+  // If zero is unlikely, simply resample; otherwise, invert CDF from k = 1
+  static int SampleBinomial_NonZero(double p, int n) {
+    double log_p_zero{n * std::log1p(-p)};
+    if (log_p_zero < -M_LN2) {
+      int k{0};
+      while (k == 0) {
+        k = gsl_ran_binomial(streams_[Kinetics], p, n);
+      }
+      return k;
+    }
+    double ran{GetUniform() * -std::expm1(log_p_zero)};
+    double p_k{n * p * std::pow(1.0 - p, n - 1)};
+    int k{1};
+    while (ran > p_k and k < n) {
+      ran -= p_k;
+      p_k *= double(n - k) / (k + 1) * p / (1.0 - p);
+      k++;
+    }
+    return k;
+  }
+  static int SamplePoisson_NonZero(double n_avg) {
+    if (n_avg > M_LN2) {
+      int k{0};
+      while (k == 0) {
+        k = gsl_ran_poisson(streams_[Kinetics], n_avg);
+      }
+      return k;
+    }
+    double ran{GetUniform() * -std::expm1(-n_avg)};
+    double p_k{n_avg * std::exp(-n_avg)};
+    int k{1};
+    while (ran > p_k and p_k > 0.0) {
+      ran -= p_k;
+      p_k *= n_avg / (k + 1);
+      k++;
+    }
+    return k;
+  }
+  static double SampleExponential(double mean) {
+    return gsl_ran_exponential(streams_[Kinetics], mean);
+  }
+  static int GetRanInt(int n, Stream stream = Selection) {
+    return gsl_rng_uniform_int(streams_[stream], n);
+  }
+  static double GetRanProb(Stream stream) {
+    return GetPhilox(stream)->GetUniform();
   }
-  static int GetRanInt(int n) { return gsl_rng_uniform_int(rng_, n); }
-  static double GetRanProb() { return gsl_rng_uniform(rng_); }
   static double GetGaussianPDF(double x, double sigma) {
     return gsl_ran_gaussian_pdf(x, sigma);
   }
   static double GetGaussianNoise(double sigma) {
-    return gsl_ran_gaussian(rng_, sigma);
+    return gsl_ran_gaussian(streams_[Noise], sigma);
   }
   static void Shuffle(void *array, int length, int element_size) {
-    gsl_ran_shuffle(rng_, array, length, element_size);
+    gsl_ran_shuffle(streams_[Selection], array, length, element_size);
   }
+  // Picks n distinct indices from [0, m) via Floyd's algorithm; O(n) per call
   static void SetRanIndices(int indices[], int n, int m) {
-    int integer_pool[m];
-    for (int i{0}; i < m; i++) {
-      integer_pool[i] = i;
+    if (chosen_.size() < m) {
+      chosen_.resize(m);
+    }
+    for (int i{0}, j{m - n}; j < m; i++, j++) {
+      int i_ran{GetRanInt(j + 1)};
+      indices[i] = chosen_[i_ran] ? j : i_ran;
+      chosen_[indices[i]] = true;
+    }
+    for (int i{0}; i < n; i++) {
+      chosen_[indices[i]] = false;
     }
-    gsl_ran_choose(rng_, indices, n, integer_pool, m, sizeof(int));
   }
 };
 #endif